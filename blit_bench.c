@@ -0,0 +1,184 @@
+/**
+ * blit_bench.c
+ *
+ * Micro-benchmark of draw_sprite(): times drawing a sprite of each
+ * width in sprite_widths[] at each pixel alignment (x % 4), opaque and
+ * with transparency, then with different amounts of transparent
+ * pixels, then clipped at each edge of the screen.  Each case reports
+ * the pixels drawn per microsecond and the system clock cycles per
+ * word of drawn pixels.
+ *
+ * On the Pico (the vga_6bit_bench target) it runs with the VGA output
+ * on, so the DMA competes for the bus as it does in the demo, and
+ * prints the results over USB every few seconds.  On the host
+ * (host/blit_bench) cycles are counted at the emulated 125MHz clock,
+ * so only the ratios mean something for the RP2040.
+ *
+ * Usage (host): blit_bench [min_us_per_case]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+
+#include "vga_6bit.h"
+#include "vga_draw.h"
+
+#define VGA_PIN_BASE    2
+#define SPRITE_HEIGHT   32
+#define MAX_WIDTH       320
+#define MAX_STRIDE      (MAX_WIDTH / 4)
+#define CLIP_WIDTH      64
+#define DENSITY_WIDTH   64
+
+static const int sprite_widths[] = {
+  1, 2, 3, 4, 5, 7, 8, 12, 16, 31, 32, 33, 64, 100, 128, 160, 255, 256, 320,
+};
+
+static const int densities[] = { 0, 25, 50, 75, 100 };
+
+enum CLIP {
+  CLIP_NONE,
+  CLIP_LEFT,
+  CLIP_TOP,
+  CLIP_RIGHT,
+  CLIP_BOTTOM,
+};
+
+static const char *const clip_names[] = { "none", "left", "top", "right", "bottom" };
+
+static unsigned int sprite_data[MAX_STRIDE * SPRITE_HEIGHT];
+static unsigned int min_us = 20000;
+
+// Fill the image with random colors, `density` percent of them the
+// transparent color 0x0c.
+static void fill_sprite(int density)
+{
+  unsigned int seed = 1;
+  for (int i = 0; i < count_of(sprite_data); i++) {
+    unsigned int word = 0;
+    for (int b = 0; b < 4; b++) {
+      seed = seed * 1103515245 + 12345;
+      unsigned int pix = (seed >> 16) & 0x3f;
+      if (pix == 0x0c) pix = 0x0d;
+      if ((seed >> 8) % 100 < density) pix = 0x0c;
+      word |= (vga_screen.sync_bits | pix) << (8*b);
+    }
+    sprite_data[i] = word;
+  }
+}
+
+static void get_position(enum CLIP clip, int width, int align, int *x, int *y)
+{
+  *x = align;
+  *y = (vga_screen.height - SPRITE_HEIGHT) / 2;
+  switch (clip) {
+  case CLIP_NONE:   break;
+  case CLIP_LEFT:   *x = -(width/2 & ~3) + align; break;
+  case CLIP_TOP:    *y = -SPRITE_HEIGHT/2; break;
+  case CLIP_RIGHT:  *x = vga_screen.width - (width/2 & ~3) + align; break;
+  case CLIP_BOTTOM: *y = vga_screen.height - SPRITE_HEIGHT/2; break;
+  }
+}
+
+// Number of pixels of the sprite at (x, y) that are on the screen
+static int visible_pixels(int x, int y, int width)
+{
+  int x0 = (x < 0) ? 0 : x;
+  int y0 = (y < 0) ? 0 : y;
+  int x1 = (x + width > vga_screen.width) ? vga_screen.width : x + width;
+  int y1 = (y + SPRITE_HEIGHT > vga_screen.height) ? vga_screen.height : y + SPRITE_HEIGHT;
+  return (x1 > x0 && y1 > y0) ? (x1 - x0) * (y1 - y0) : 0;
+}
+
+// Draw the sprite at (x, y) for at least min_us and print the results
+static void run_case(int width, int align, int density, enum CLIP clip, unsigned int flags)
+{
+  struct SPRITE spr = { width, SPRITE_HEIGHT, (width + 3) / 4, sprite_data };
+  int x, y;
+  get_position(clip, width, align, &x, &y);
+
+  unsigned int draws = 0;
+  uint64_t start = time_us_64();
+  uint64_t elapsed;
+  do {
+    for (int i = 0; i < 16; i++) {
+      draw_sprite(&spr, x, y, flags);
+    }
+    draws += 16;
+    elapsed = time_us_64() - start;
+  } while (elapsed < min_us);
+
+  double pixels = (double) visible_pixels(x, y, width) * draws;
+  double cycles = (double) elapsed * (clock_get_hz(clk_sys) / 1000000);
+  printf("%5d %5d %7s %7d %6s %10.2f %10.2f\n",
+         width, align, (flags & DRAW_TRANSPARENT) ? "yes" : "no", density, clip_names[clip],
+         pixels / elapsed, cycles / (pixels / 4));
+}
+
+static void run_benchmark(void)
+{
+  printf("width  x%%4 transp density   clip   pixels/us cycles/word\n");
+
+  // every width and alignment, opaque and with half the pixels transparent
+  fill_sprite(50);
+  for (int w = 0; w < count_of(sprite_widths); w++) {
+    for (int align = 0; align < 4; align++) {
+      run_case(sprite_widths[w], align, 50, CLIP_NONE, 0);
+      run_case(sprite_widths[w], align, 50, CLIP_NONE, DRAW_TRANSPARENT);
+    }
+  }
+
+  // amount of transparent pixels
+  for (int d = 0; d < count_of(densities); d++) {
+    fill_sprite(densities[d]);
+    for (int align = 0; align < 4; align++) {
+      run_case(DENSITY_WIDTH, align, densities[d], CLIP_NONE, DRAW_TRANSPARENT);
+    }
+  }
+
+  // clipping at each edge of the screen
+  fill_sprite(50);
+  for (enum CLIP clip = CLIP_LEFT; clip <= CLIP_BOTTOM; clip++) {
+    for (int align = 0; align < 4; align++) {
+      run_case(CLIP_WIDTH, align, 50, clip, 0);
+      run_case(CLIP_WIDTH, align, 50, clip, DRAW_TRANSPARENT);
+    }
+  }
+}
+
+#if PICO_ON_DEVICE
+
+int main(void)
+{
+  stdio_init_all();
+  if (vga_init(&vga_mode_320x240, VGA_PIN_BASE) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+
+  while (true) {
+    // give the USB host time to connect
+    sleep_ms(5000);
+    printf("\ndraw_sprite() benchmark, sys clock %u kHz\n", (unsigned int) (clock_get_hz(clk_sys) / 1000));
+    run_benchmark();
+  }
+}
+
+#else
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1) min_us = atoi(argv[1]);
+
+  if (vga_init(&vga_mode_320x240, VGA_PIN_BASE) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  run_benchmark();
+  return 0;
+}
+
+#endif
@@ -3,7 +3,7 @@
 #define img_loserboy_width   51
 #define img_loserboy_height  40
 #define img_loserboy_stride  13
-#define img_loserboy_num_spr 44
+#define img_loserboy_num_spr 22
 
 const unsigned int img_loserboy_data[] = {
   0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
@@ -726,721 +726,6 @@ const unsigned int img_loserboy_data[] = {
   0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
   0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
   0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccc0c0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xc0d0d4d4,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4d4c0d4,0xd4c0d0d0,0xccc0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xe5d4c0d0,0xc0d4e5e5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d0d0,0xe5e5d4c0,0xc0c0d4e5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,
-  0xc0eac0c0,0xd4d4d0d0,0xd4e5d4c0,0xd7d7c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xeac0c0cc,0xeaeaeaea,0xd4d0d0c0,0xc0d4d4c0,
-  0xebebd7d7,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xeac0c0cc,0xeaeaeaea,0xd4d0c0ea,0xc0c0c0d0,0xebebd7c0,0xccc0d7eb,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xeac0cccc,0xeaeaeaea,
-  0xd4c0eaea,0xd7c0d4d0,0xebd7d7d7,0xccc0d7eb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xeaeaeaea,0xd0c0eaea,0xebd7c0d4,0xebebebeb,
-  0xccc0d7eb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd7c0cccc,
-  0xd7d7d7d7,0xeaeaeac0,0xc0eaeaea,0xebebd7c0,0xebebebeb,0xccc0d7eb,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd7c0cccc,0xd7ebebeb,0xeaeaeac0,0xc0eaeaea,
-  0xebebd7c0,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xd7c0cccc,0xc0d7ebeb,0xeaeaeaea,0xc0eaeaea,0xebd7c0d4,0xd7d7ebeb,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd7c0cccc,0xc0d7ebeb,
-  0xeaeaeaea,0xc0eaeaea,0xd7c0d0c0,0xc0c0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xd7c0cccc,0xc0c0d7eb,0xeaeaeaea,0xc0eaeaea,0xc0c0d0c0,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xead5c0d7,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5eaea,
-  0xc0c0c0d5,0xd5c0c0c0,0xc0c0c0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5eaeaea,0xc0c0d5d5,0xd5d5c0c0,0xc0c0d5d5,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xeaeaead5,0xc0c0d5d5,0xd5c0c0c0,0xd5c0c0d5,0xc0c0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xc0c0c0c0,
-  0xc0c0c0c0,0xd5d5c0d5,0xc0c0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0d5d5c0,0xd5d5d5d5,0xc0c0c0c0,0xd5d5d5c0,0xccc0c0d5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,
-  0xeaead5d5,0xd5eaeaea,0xc0c0c0d5,0xd5d5d5c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0c0cc,0xeaeaeaea,0xeaeaeaea,0xc0c0c0d5,
-  0xc0c0d5c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,
-  0xc0c0c0c0,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4d0c0d0,0xc0c0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xd4c0d0d4,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d4d4,0xe5d4c0d0,0xccc0d4e5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,
-  0xc0eaeac0,0xd0d4d4d0,0xe5e5d4c0,0xccc0c0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xeac0cccc,0xeaeaeaea,0xc0d4d4c0,0xd4e5e5d4,
-  0xc0d7d7c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xeac0cccc,0xeaeaeaea,0xc0d4d0c0,0xc0d4e5d4,0xd7ebebd7,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xeaeaeaea,
-  0xd0d4c0ea,0xd7c0d4c0,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xd7d7d7c0,0xeaeaeac0,0xd4d4c0ea,0xd7c0c0d0,0xebebd7d7,
-  0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xebebebd7,0xeaeac0d7,0xd4d0c0ea,0xd7d7c0d4,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xebebebd7,0xeaeac0d7,0xd4c0eaea,
-  0xebd7c0d4,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xd7ebebd7,0xeaeac0d7,0xd4c0eaea,0xebd7c0d4,0xd7ebebeb,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd7d7d7c0,
-  0xc0c0c0c0,0xd4c0eaea,0xd7c0c0d4,0xc0d7d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xd5d5d5d5,0xc0c0c0c0,0xc0c0c0d4,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xeaeaeac0,0xc0d5d5ea,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xeaead5c0,
-  0xd5d5eaea,0xc0c0c0c0,0xc0c0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xeaeac0c0,0xd5eaeaea,0xc0c0c0d5,0xc0c0d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0c0cc,0xead5c0c0,0xc0c0d5d5,0xc0d5d5c0,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xd5c0d5d5,
-  0xc0c0d5d5,0xd5d5d5c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xeaead5c0,0xeaeaeaea,0xc0c0c0d5,0xc0c0c0c0,0xccc0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,
-  0xeaeaead5,0xd5eaeaea,0xd5c0c0d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xeaead5d5,0xd5d5eaea,0xd5d5c0c0,
-  0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0cccc,0xd5d5d5c0,0xc0d5d5d5,0xd5d5d5c0,0xc0c0d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,
-  0xc0c0c0c0,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xc0c0cccc,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xd4c0c0c0,0xccccc0d4,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xd0c0d0c0,0xe5d4c0d0,0xccccc0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xc0d0d4d0,0xe5e5d4c0,0xccc0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4c0d4d4,0xc0e5d4c0,0xc0d7d7d7,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4d0c0c6,0xd4d4c0d4,
-  0xc0e5d4c0,0xd7ebebd7,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xd4c0c0c0,0xd4d4d4c0,0xc0d4c0d0,0xebebebd7,0xccc0d7eb,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,
-  0xc0eaeac0,0xd4d4d0c0,0xc0c0d0d0,0xd7d7d7c0,0xc0d7d7d7,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xccccc0c0,0xeac0c0c0,0xeaeaeaea,0xd4d0c0ea,0xccc0d0d4,
-  0xebd7c0cc,0xc0d7ebeb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c0cccc,
-  0xc0c0d7d7,0xeac0c0c0,0xeaeaeaea,0xd4d0c0ea,0xc0d0d4d4,0xebd7c0cc,0xc0d7ebeb,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebd7c0cc,0xd7d7ebeb,0xeac0c0d7,0xeaeaeaea,
-  0xd0c0eaea,0xd0d4d4d4,0xebd7c0c0,0xc0d7ebeb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebd7c0cc,0xebebebeb,0xeac0c0d7,0xeaeaeaea,0xd0c0eaea,0xd4d4d4d4,0xd7c0c0d0,
-  0xccc0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebd7c0cc,0xd7d7ebeb,
-  0xc0c0c0d7,0xeaeac0c0,0xd0c0eaea,0xd4d4d4d0,0xc0c0d0d4,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c0cccc,0xc0c0d7d7,0xd5d5c0c0,0xeac0c0d5,0xc0eaeaea,
-  0xd4d4d4d0,0xccc0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0cccccc,0xccccc0c0,0xeaead5c0,0xc0c0c0d5,0xc0eaeaea,0xd0d4d4d0,0xccccc0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xeaeaeac0,
-  0xc0c0d5d5,0xc0eaeac0,0xd0d0d4d0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xeaeaead5,0xc0d5d5ea,0xc0c0c0c0,0xc0c0d0d0,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xeaeaead5,0xc0d5d5ea,0xd4c0ccc0,0xc0d4c0c0,0xc0c0c0c0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xeaeaead5,0xead5d5ea,0xc0d5d5ea,
-  0xc0ccccc0,0xc0c0d4d4,0xd5d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xc0c0c0cc,0xeaead5c0,0xd5eaeaea,0xc0d5d5d5,0xc0ccccc0,0xd5c0c0c0,0xd5d5d5d5,
-  0xccc0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xd5c0c0c0,
-  0xeaeaeaea,0xc0c0c0d5,0xc0ccccc0,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xeaead5c0,0xc0c0d5ea,0xccccccc0,
-  0xd5d5c0c0,0xd5c0c0c0,0xc0c0c0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xd5c0c0c0,0xc0d5d5ea,0xcccccccc,0xc0c0c0c0,0xd5d5d5d5,0xc0c0d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,
-  0xc0d5d5d5,0xc0cccccc,0xd5d5c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccc0c0c0,0xc0cccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xc0c0c0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0c0cc,0xccccc0c0,0xc0cccccc,0xd5d5c0c0,0xc0c0d5d5,0xc0c0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xc0c0cccc,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xd4c0c0c0,0xccccc0d4,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xd4d4c0d0,0xccc0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xc0d0d4d0,0xe5d4d4c0,0xc0c0c0e5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4c0d4d4,0xe5e5d4c0,0xd7d7d7c0,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4d0c0c6,0xd4d4c0d4,
-  0xc0e5d4c0,0xebebebd7,0xc0c0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xd4c0c0c0,0xd4d4d4c0,0xc0d4c0d0,0xebebd7d7,0xd7d7d7eb,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xccccccc0,0xc0c0c0c0,
-  0xc0eaeac0,0xd0d4d4d0,0xc0c0c0d0,0xebd7c0c0,0xebebd7d7,0xccccc0d7,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xd7d7c0cc,0xc0c0c0d7,0xc0c0d4c0,0xeaeaeaea,0xd4d4d0c0,0xccc0d0d0,
-  0xd7c0cccc,0xebebebd7,0xccccc0d7,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebebd7c0,
-  0xd7d7d7eb,0xeac0d4c0,0xeaeaeaea,0xd4d0c0ea,0xc0d0d4d4,0xc0cccccc,0xebebebd7,0xccccc0d7,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebebd7c0,0xd7ebebeb,0xeac0d4c0,0xeaeaeaea,
-  0xd4c0eaea,0xc0d0d4d4,0xc0cccccc,0xebebebd7,0xccccc0d7,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebd7d7c0,0xd7d7ebeb,0xeac0d4c0,0xeaeaeaea,0xd0c0eaea,0xd0d4d4d4,0xccccccc0,
-  0xd7d7d7c0,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7d7c0cc,0xc0d7d7d7,
-  0xeaeac0c0,0xeaeaeaea,0xc0eaeaea,0xd4d4d4d4,0xccc0c0d0,0xc0c0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xc0c0c0c0,0xeaeaeac0,0xc0eaeaea,
-  0xd4d4d4d4,0xc0d4c0d0,0xd5d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xeaeac0d5,0xc0eaeaea,0xd0d4d4d4,0xc0d4d4c0,0xd5d5d5d5,
-  0xc0c0d5d5,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5eaead5,
-  0xeaeac0d5,0xeaeaeaea,0xc0d0d0c0,0xd5c0d4d4,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xd5c0c0c0,0xeaeaeaea,0xeac0d5d5,0xc0c0c0ea,0xc0c0c0cc,
-  0xd5d5c0d4,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xeaeaead5,0xc0c0d5d5,0xccccccc0,0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xd5d5d5d5,
-  0xccccc0d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0c0,0xd5d5eaea,0xeaead5d5,0xccc0d5d5,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xccc0d5d5,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5c0c0cc,0xeaeaead5,0xead5d5d5,0xccc0d5d5,0xcccccccc,0xcccccccc,0xd5c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xccc0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xeaead5c0,
-  0xead5d5ea,0xccc0d5d5,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xd5d5d5d5,0xc0d5d5d5,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xead5c0c0,0xead5d5ea,0xccc0d5d5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0cccccc,0xd5c0c0c0,0xd5d5d5ea,0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,
-  0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xd5d5d5c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0c0cccc,0xd5d5c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5d5c0,
-  0xccc0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xccccc0c0,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xc0c0cccc,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0d0c0c0,0xd4d4c0c0,0xc0c0c0d4,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xd4d4d0c0,0xe5e5d4c0,0xd7d7c0d4,0xc0c0c0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xc0d4d4d0,0xe5e5d4c0,0xebebd7c0,
-  0xd7d7d7eb,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0c0d4d4,0xe5e5d4c0,0xebd7d7c0,0xebebd7eb,0xccc0d7d7,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4c0c0c6,0xd0d0c0d4,
-  0xd4d4c0c0,0xd7c0c0c0,0xebebebd7,0xc0d7ebeb,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d4c0,0xc0c0c0d0,0xc0ccccc0,0xebebd7c0,
-  0xc0d7ebeb,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xeaeac0c0,0xd4c0c0ea,0xc0c0d4d4,0xcccccccc,0xebd7c0cc,0xc0d7ebeb,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xd0c0d4e5,0xeaeaeac0,0xc0eaeaea,0xd0d4d4d4,
-  0xccccc0c0,0xd7d7c0cc,0xccc0d7d7,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xd0c0d4e5,0xeaeaeac0,0xeaeaeaea,0xd4d4d4c0,0xc0c0d0d0,0xc0c0cccc,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xd0c0d4e5,0xeaeaeac0,
-  0xeaeaeaea,0xd4d4c0ea,0xd0d0d4d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xd0c0d4d4,0xeaeaeac0,0xeaeaeaea,0xd4d4c0ea,0xd0d4d4d4,
-  0xc0ccccc0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xd0c0d4c0,0xeaeaeac0,0xeaeaeaea,0xd0c0eaea,0xd0d4d4d4,0xd5c0ccc0,0xc0d5d5d5,0xccccccc0,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xeaeac0c0,0xeaeaeaea,
-  0xd0c0eaea,0xc0d0d4d4,0xd5d5c0cc,0xd5d5d5d5,0xccccc0d5,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xeac0d5d5,0xeaeaeaea,0xd0c0eaea,0xc0d0d0d4,0xd5d5d5c0,
-  0xd5d5d5d5,0xccc0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xd5d5d5c0,
-  0xc0d5d5ea,0xeaeaeaea,0xd0c0eaea,0xd4c0d0d0,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,
-  0xc0cccccc,0xc0cccccc,0xd5d5c0c0,0xd5d5d5d5,0xead5d5c0,0xc0d5eaea,0xeaeaeaea,0xc0eaeaea,
-  0xd4d4c0c0,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xc0cccccc,0xead5c0c0,
-  0xd5d5eaea,0xeaead5d5,0xd5d5eaea,0xeaeaeac0,0xccc0c0ea,0xc0d4d4c0,0xd5d5d5d5,0xd5d5d5d5,
-  0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,0xd5c0c0c0,0xd5eaeaea,0xeaeaead5,0xd5d5eaea,
-  0xc0c0c0c0,0xccccccc0,0xd5c0d4c0,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xc0cccccc,
-  0xcccccccc,0xc0c0c0c0,0xeaeaead5,0xeaead5d5,0xc0d5d5ea,0xccccccc0,0xcccccccc,0xd5c0c0cc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xeaead5c0,
-  0xead5d5ea,0xc0c0d5d5,0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5c0c0c0,0xd5d5d5d5,0xd5d5d5d5,
-  0xccccccc0,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xead5c0c0,0xd5d5eaea,0xccc0d5d5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,
-  0xc0c0cccc,0xd5c0c0c0,0xd5d5d5ea,0xccc0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xd5c0c0cc,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xccccccc0,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xc0d5d5c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0c0c0cc,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccc0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0d4c0d4,0xccc0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xc0d0d4d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xc0d4d0c0,0xd0c0c0c0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,
-  0xd0d0c0c0,0xd4c0d4d4,0xc0d4d4d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0d7d7,0xd4c0c0c0,0xd4e5e5e5,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd7d7c0cc,0xd7d7ebeb,0xc0d7d7d7,0xe5e5d4d4,0xccccc0d4,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xebd7c0cc,0xebebebeb,
-  0xd7ebebeb,0xd4d4c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xebd7c0cc,0xebebebeb,0xd7d7ebeb,0xc0c0c0d7,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xd7c0c0cc,0xd7d7d7d7,0xc0d7d7d7,0xd4c0c0c0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xd4c0c0c0,
-  0xd4d4d4d4,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd4d4c0c0,0xd0d4d4d4,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xd4d4c0d5,0xc0d0d0d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xd0d0d0c0,0xd5c0c0d0,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0c0c0,0xd5d5d5c0,0xc0c0d5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xc0d5d5d5,
-  0xd5d5d5d5,0xeaead5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xc0d5d5d5,0xead5d5d5,0xeaeaeaea,0xd5d5d5d5,
-  0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xd5c0cccc,0xd5d5d5d5,0xd5d5d5c0,0xeaeaeaea,0xd5d5d5ea,0xccc0d5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5c0d5,
-  0xd5d5d5d5,0xead5d5d5,0xccc0d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xc0c0d5d5,0xd5d5d5c0,0xeaead5d5,0xccc0d5d5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,
-  0xd5d5d5d5,0xc0c0c0d5,0xead5d5d5,0xd5eaeaea,0xccc0d5d5,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xc0ccc0d5,0xeaead5d5,
-  0xd5eaeaea,0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xc0ccccc0,0xeaead5d5,0xd5d5eaea,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,
-  0xcccccccc,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccc0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4d4c0d4,0xccc0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xc0d0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xc0d4d4c0,0xd0d4c0c0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,
-  0xd4d0d0c0,0xd4c0d4d4,0xd0c0d4d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0d7ebc0,0xd0d0c0ea,0xd4c0c0d0,0xc0d4e5e5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0d7ebc0,0xc0d0c0ea,0xc0d7d7c0,0xd4e5e5d4,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0d7d7c0,0xd7c0c0c0,
-  0xd7ebebd7,0xc0d4d4c0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xebd7d7d7,0xd7ebebeb,0xd0c0c0d7,0xccc0d0d4,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xebebebd7,0xc0d7d7eb,0xd4d4d4c0,0xccc0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7ebebd7,0xd0c0c0d7,
-  0xd4d4d4d4,0xccc0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0d7d7c0,0xd0d0c0c0,0xd4d4d4d4,0xccc0d0d4,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xeac0c0c0,0xd0d0c0ea,0xd0d0d0d0,0xc0c0c0d0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xeaeaeac0,0xc0c0c0ea,0xc0c0c0c0,
-  0xd5d5c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5c0cccc,0xc0c0c0c0,0xc0c0c0c0,0xc0d5d5d5,0xd5d5d5c0,0xccc0c0d5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xc0c0d5d5,
-  0xd5c0c0c0,0xd5d5d5d5,0xeaeac0d5,0xccc0d5ea,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0d5d5d5,0xd5c0c0c0,0xeaeaeaea,0xeaeaeaea,
-  0xc0d5eaea,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd5d5d5c0,0xc0c0c0c0,0xeaeaead5,0xeaeaeaea,0xc0ead5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xc0c0c0d5,
-  0xead5d5c0,0xc0d5eaea,0xd5ead5c0,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5d5c0c0,0xc0c0d5d5,0xc0c0c0c0,0xd5c0c0d5,0xd5eaead5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,
-  0xd5d5d5d5,0xc0c0d5d5,0xc0ccc0c0,0xd5d5c0c0,0xd5eaeaea,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccc0c0,
-  0xd5c0c0cc,0xd5eaead5,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5d5c0,0xc0c0d5d5,0xc0c0c0c0,0xccccc0c0,0xc0c0cccc,0xd5d5d5d5,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,
-  0xc0c0c0c0,0xccccccc0,0xcccccccc,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccc0c0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0d4c0d4,0xc0c0c0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xc0c0d0d0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d0c0,0xc0c0d0d0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,
-  0xd4d4c0c0,0xd4d4c0d4,0xc0d0d0d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xd7d7c0cc,0xc0c0c0d7,0xe5d4c0c0,0xd4d4c0d4,0xc0d4c0d4,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xebebd7c0,0xd7d7d7eb,0xd4c0d7d7,0xd4c0d4e5,0xd4d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xebebd7c0,0xebebebeb,0xd4c0d7eb,
-  0xc0c0d4e5,0xd4d4d4d0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xebebd7c0,0xebebebeb,0xd4c0d7eb,0xd0c0d4d4,0xd4d4d4d0,0xccccc0d4,
-  0xc0cccccc,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd7d7c0cc,
-  0xd7d7d7d7,0xc0c0c0d7,0xd0d0c0c0,0xd4d4d4d4,0xccc0d0d4,0xc0c0c0cc,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xeaeaeac0,0xd4d0c0ea,
-  0xd4d4d4d4,0xccc0d4d4,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0c0c0c0,0xeaeac0c0,0xd4d0c0ea,0xd4d4d4d4,0xc0c0d0d4,0xd5d5c0c0,
-  0xc0d5c0c0,0xccccccc0,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,
-  0xeac0c0c0,0xd4d0c0ea,0xd0d4d4d4,0xc0d4c0d0,0xd5d5c0c0,0xd5d5c0d5,0xccccc0c0,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xc0c0c0d5,0xd4c0c0c0,0xc0d0d0d4,
-  0xc0e5e5c0,0xead5c0c0,0xd5eac0d5,0xccc0c0d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5c0c0,0xc0c0d5d5,0xc0ccccc0,0xd4c0c0c0,0xc0e5e5e5,0xeaead5c0,0xeaead5d5,
-  0xc0c0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5c0c0c0,0xc0d5d5d5,
-  0xccccccc0,0xc0cccccc,0xc0e5e5d4,0xeaead5c0,0xeaeac0d5,0xc0d5d5ea,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0c0,0xc0d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xc0e5d4c0,
-  0xeaead5c0,0xeaeac0d5,0xc0d5eaea,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,
-  0xd5d5d5d5,0xd5d5d5c0,0xccccc0c0,0xcccccccc,0xc0c0c0cc,0xeaeaeac0,0xead5c0c0,0xc0d5eaea,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5c0c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccc0c0,
-  0xcccccccc,0xc0c0c0cc,0xc0eaeaea,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xd5d5d5c0,0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xd5c0c0c0,
-  0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,0xc0c0d5c0,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xc0c0c0c0,0xc0c0d0d0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xd0d0d0c0,0xccc0c0d0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xd0d0c0d0,0xc0d0c0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xd0c0d0d4,0xc0e5c0d0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xc0c0c0c6,0xd4d0c0c0,0xc0d0d4d4,0xc0e5e5c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4d4d4c0,0xd4d4d0c0,
-  0xc0d0d4d4,0xebc0e5e5,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc6c0c0c6,0xc0c0c6c6,0xd4e5d4c0,0xd4d4d0c0,0xd0d4c0d4,0xebebc0c0,0xccccc0d7,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0d7d7c0,0xd7d7c0c0,
-  0xe5e5d4c0,0xc0d4c0d4,0xd4d4d0c0,0xd7ebc0d0,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd7ebebd7,0xebebd7d7,0xe5e5c0d7,0xd0c0c0d4,0xd4d4d4d0,
-  0xd7d7c0d0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,
-  0xebebebd7,0xebebebeb,0xd4d4c0d7,0xd0d0c0d4,0xd4d4d4d0,0xc0c0d0d4,0xcccccccc,0xc0c0c0cc,
-  0xccccccc0,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xebebd7d7,0xd7d7ebeb,0xc0c0c0c0,
-  0xd0d0c0c0,0xd4d4d4d4,0xccc0d0d4,0xc0c0cccc,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xd7d7d7c0,0xc0c0d7d7,0xeaeaeac0,0xd4d0c0ea,0xd4d4d4d4,0xc0c0d4d4,
-  0xc0c0c0c0,0xd5d5c0c0,0xccc0c0c0,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,
-  0xc0c0c0c0,0xeaeac0d4,0xd4d0c0ea,0xd4d4d4d4,0xc0c0d0d4,0xd5c0c0c0,0xead5d5d5,0xc0c0d5d5,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0d5d5d5,0xeac0d4d4,0xd4d0c0ea,
-  0xd0d4d4d4,0xc0c0c0d0,0xeaead5c0,0xeaead5ea,0xc0c0d5ea,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xd5c0cccc,0xc0c0d5d5,0xc0d4d4c0,0xd4c0c0c0,0xc0d0d0d4,0xc0d4e5c0,0xeaeaead5,
-  0xead5d5ea,0xc0d5eaea,0xccccccc0,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xc0d5d5d5,
-  0xc0d4c0c0,0xc0ccccc0,0xe5c0c0c0,0xc0d4e5e5,0xeaead5d5,0xd5c0d5ea,0xd5d5eaea,0xccccccc0,
-  0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xd5d5c0c0,0xc0d5d5d5,0xccc0c0c0,0xcccccccc,0xd4c0cccc,
-  0xc0d4d4d4,0xeaead5c0,0xd5c0d5d5,0xd5eaeaea,0xccccc0c0,0xc0cccccc,0xc0cccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xd5c0c0c0,
-  0xd5eaeaea,0xccccc0c0,0xc0cccccc,0xc0cccccc,0xd5c0c0c0,0xc0d5d5d5,0xc0d5d5c0,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xd5d5ead5,0xccccc0c0,0xc0cccccc,
-  0xc0cccccc,0xc0c0c0c0,0xd5d5d5d5,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccc0c0,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xd5d5d5c0,
-  0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,
-  0xccccccc0,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xd5d5c0c0,0xc0c0c0d5,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0cccc,0xd5c0c0c0,0xc0c0c0d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5c0c0c0,0xc0c0c0c0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0c0c0cc,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xc0c0c0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xe5d4c0d0,0xc0c0c0c0,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0d4c0d4,0xe5d4c0d0,0xd7d7d7c0,0xccc0d7d7,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xc0d0c0c6,0xd4d4d4c0,
-  0xe5d4c0d0,0xebebebc0,0xccc0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0cccc,0xc6c6c6c0,0xc6c6c6c6,0xd4c0c0c0,0xc0d4d4d4,0xe5c0d0d0,0xebd7d7c0,0xccc0d7eb,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7d7c0cc,0xccccc0d7,0xc0c0cccc,
-  0xd4d4c0c0,0xc0d4d4d4,0xc0d0d0d0,0xc0c0c0c0,0xccc0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xebebd7c0,0xc0c0d7eb,0xd4d4c0c0,0xd4d4c0d4,0xd0c0d0d4,0xd0d0d4d0,
-  0xc0ccccc0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebebd7c0,
-  0xd7d7ebeb,0xe5d4c0d7,0xd4d0c0d4,0xd0d0c0d0,0xd0d4d4d4,0xccccc0d0,0xcccccccc,0xc0c0c0cc,
-  0xccc0c0c0,0xcccccccc,0xc0cccccc,0xcccccccc,0xebebd7c0,0xebebebeb,0xe5d4c0d7,0xd0c0c0d4,
-  0xd0d0d0c0,0xd4d4d4d4,0xccc0d0d0,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccccc0,0xc0cccccc,
-  0xcccccccc,0xd7d7c0cc,0xd7d7d7d7,0xe5d4c0d7,0xc0c0c0d4,0xd4d0d0d0,0xd4d4d4d4,0xc0c0d0d4,
-  0xc0cccccc,0xd5d5c0c0,0xc0d5ead5,0xccc0c0c0,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,
-  0xd4c0c0c0,0xc0d4c0c0,0xd4d4d0c0,0xd4d4d4d4,0xd4d4c0d0,0xc0c0ccc0,0xeaead5c0,0xd5eaead5,
-  0xc0c0c0d5,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xd4d4d4c0,0xd4d0d0c0,
-  0xd0d4d4d4,0xd4e5c0d0,0xc0c0c0d4,0xeaead5d5,0xeaead5d5,0xc0d5d5ea,0xc0ccccc0,0xc0c0c0cc,
-  0xccccc0c0,0xcccccccc,0xd5d5c0c0,0xd4d4d4c0,0xd4d0c0d4,0xd0d0d4d4,0xe5e5d4c0,0xd5d5c0c0,
-  0xeaeaead5,0xead5d5d5,0xd5d5eaea,0xc0ccc0c0,0xd5d5c0c0,0xc0c0d5d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xd4d4c0d5,0xd0d0c0c0,0xd0d0d0d4,0xd4e5d4c0,0xd5d5d5c0,0xd5eaeaea,0xd5d5c0c0,0xd5eaeaea,
-  0xc0c0c0d5,0xd5c0c0c0,0xd5d5d5d5,0xd5d5c0c0,0xd5d5d5d5,0xc0c0c0c0,0xd0d0c0cc,0xc0c0d0d0,
-  0xc0d4c0cc,0xead5d5c0,0xd5d5eaea,0xd5c0c0c0,0xd5d5d5d5,0xc0c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xd5d5d5d5,0xd5d5d5d5,0xccccc0c0,0xc0c0c0cc,0xccccc0c0,0xc0c0cccc,0xead5c0c0,0xc0c0d5ea,
-  0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xc0ccccc0,0xc0c0c0c0,0xc0ccccc0,
-  0xc0c0c0cc,0xd5d5c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0cc,0xd5d5c0c0,0xc0d5d5d5,
-  0xc0c0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0cccc,0xd5c0c0c0,0xc0d5d5d5,0xccc0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0cccc,
-  0xc0c0c0c0,0xc0c0d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0d5,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5d5d5d5,0xc0d5d5d5,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xc0c0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,
-  0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xc0c0d5d5,0xd5d5d5c0,
-  0xd5c0c0c0,0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xc0cccccc,0xd5d5c0d5,0xffc0c0d5,0xd5c0c0eb,0xc0d7d7c0,0xccccc0d5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0d5c0,
-  0xffc0eac0,0xc0c6ebff,0xd7ebebc0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0d5c0,0xffc0eaeb,0xd7ebebff,0xd7ebebeb,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xffead5c6,0xffd5eaeb,0xd7ebebff,0xd7ebebeb,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xebffffc6,0xffffffeb,
-  0xd7ebebeb,0xc0d7d7eb,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xebebebc6,0xc6c6ebeb,0xd7d7ebeb,0xc0c0c0d7,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xebebc6cc,0xebd7c6eb,0xc6d7d7eb,0xc0d4d0c0,0xccc0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc6c6cccc,0xd7ebebeb,0xc0c6c6d7,
-  0xd0c0d4d4,0xc0d0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xd0c0c6c6,0xd0c0d4d0,0xc0d0d4d4,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc6c0d4c0,0xc0c0c6c6,0xd4c0c0c0,0xd4c0c0d4,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xcccccccc,0xc0c0d4c0,0xc0eac0c0,0xd0c0d0d0,
-  0xe5e5d4c0,0xccc0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xebebebc0,0xc0c0c0c0,0xeac0d4c0,0xc0eaeaea,0xc0c0d0d0,0xe5e5e5d4,0xccc0d4e5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xebebebeb,0xc0ebc0eb,0xeac0d4d4,
-  0xc0eaeaea,0xc0d0d0d0,0xe5e5e5e5,0xccc0c0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xc0cccccc,0xebebebd7,0xc0ebc0eb,0xeac0d4d4,0xeaeaeaea,0xc0d0d0c0,0xc0d4e5d4,
-  0xc0d7d7c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xebebebd7,
-  0xc0d7ebc0,0xeac0d4d4,0xeaeaeaea,0xc0d0d0c0,0xd7c0d4d4,0xc0ebebd7,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xebebd7d7,0xc0c0c0c0,0xeac0d4d4,0xeaeaeaea,
-  0xd0d0d0c0,0xc0ccc0c0,0xebebd7d7,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xc0c0c0c0,0xd0c0cccc,0xeaeac0d4,0xeaeaeaea,0xd0d0d0c0,0xccccccc0,0xebd7d7c0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd0c0cccc,
-  0xeaeac0d4,0xeaeaeaea,0xd0d0c0ea,0xc0ccc0d0,0xebebd7d7,0xccccc0eb,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd0c0cccc,0xeaeac0d4,0xeaeaeaea,0xd0d0c0ea,
-  0xc0c0d0d0,0xebebebd7,0xccccc0eb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xd0d0c0cc,0xeaeac0d0,0xeaeaeaea,0xd0c0eaea,0xd7c0d0d0,0xebebd7d7,0xccccc0eb,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xeaeaeac0,
-  0xeaeaeaea,0xc0eaeaea,0xc0c0c0c0,0xd7d7d7d7,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xeac0c0d5,0xeaeaeaea,0xc0c0eaea,0xd5d5d5d5,
-  0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xead5d5c0,0xc0d5d5d5,0xc0c0c0c0,0xd5d5c0c0,0xd5d5eaea,0xccccc0d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xeaead5c0,0xd5d5d5ea,0xccccccc0,
-  0xead5c0cc,0xd5eaeaea,0xccc0d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xc0cccccc,0xeaead5d5,0xd5d5d5ea,0xccccccc0,0xead5c0cc,0xd5eaeaea,0xc0d5d5d5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xead5d5d5,
-  0xd5d5d5ea,0xccccc0d5,0xead5c0cc,0xd5eaeaea,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,0xd5c0cccc,
-  0xd5d5eaea,0xd5d5d5d5,0xccc0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0cccc,
-  0xead5d5d5,0xd5eaeaea,0xd5d5d5d5,0xccccc0d5,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xc0d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5c0cc,0xeaeaead5,0xd5d5eaea,0xd5d5d5d5,
-  0xccccc0d5,0xd5c0cccc,0xd5d5d5d5,0xeaeaead5,0xd5d5d5ea,0xccc0c0d5,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,0xc0cccccc,0xd5d5d5d5,
-  0xeaeaeaea,0xd5d5eaea,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,
-  0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xc0cccccc,0xc0c0c0cc,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
   0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xccc0cccc,0xc0c0cccc,
   0xc0c0c0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
   0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5d5c0cc,0xd5d5d5d5,0xccc0c0c0,0xcccccccc,
@@ -2151,719 +1436,4 @@ const unsigned int img_loserboy_data[] = {
   0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,
   0xd5d5d5d5,0xd5d5d5d5,0xc0c0d5d5,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xc0c0c0c0,
   0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xc0ccc0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccc0c0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xc0d0d4d4,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4d4c0d4,0xd4c0d0d0,0xccc0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xe5d4c0d0,0xc0d4e5e5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d0d0,0xe5e5d4c0,0xc0c0d4e5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xc0eac0c0,0xd4d4d0d0,0xd4e5d4c0,0xd7d7c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xeac0d4e5,0xeaeaeaea,0xd4d0d0c0,0xc0d4d4c0,
-  0xebebd7d7,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xeac0d4e5,0xeaeaeaea,0xd4d0c0ea,0xc0c0c0d0,0xebebd7c0,0xccc0d7eb,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xeac0d4e5,0xeaeaeaea,
-  0xd4c0eaea,0xd7c0d4d0,0xebd7d7d7,0xccc0d7eb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xc0d4d4d4,0xeaeaeaea,0xd0c0eaea,0xebd7c0d4,0xebebebeb,
-  0xccc0d7eb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xc0d4d4c0,0xeaeaeaea,0xc0eaeaea,0xebebd7c0,0xebebebeb,0xccc0d7eb,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xeaeaeaea,0xc0eaeaea,
-  0xebebd7c0,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xeaeaeaea,0xc0eaeaea,0xebd7c0d4,0xd7d7ebeb,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xeaeaeaea,0xc0eaeaea,0xd7c0d0c0,0xc0c0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xeaeaeaea,0xc0eaeaea,0xc0c0d0c0,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xeac0cccc,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xd5d5eaea,
-  0xc0c0c0d5,0xd5c0c0c0,0xc0c0c0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5eaeaea,0xc0c0d5d5,0xd5d5c0c0,0xc0c0d5d5,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xeaeaead5,0xc0c0d5d5,0xd5c0c0c0,0xd5c0c0d5,0xc0c0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xc0c0c0c0,
-  0xc0c0c0c0,0xd5d5c0d5,0xc0c0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0d5d5c0,0xd5d5d5d5,0xc0c0c0c0,0xd5d5d5c0,0xccc0c0d5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,
-  0xeaead5d5,0xd5eaeaea,0xc0c0c0d5,0xd5d5d5c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0c0cc,0xeaeaeaea,0xeaeaeaea,0xc0c0c0d5,
-  0xc0c0d5c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,
-  0xc0c0c0c0,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4d0c0d0,0xc0c0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xd4c0d0d4,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d4d4,0xe5d4c0d0,0xccc0d4e5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xc0eaeac0,0xd0d4d4d0,0xe5e5d4c0,0xccc0c0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xeac0d4e5,0xeaeaeaea,0xc0d4d4c0,0xd4e5e5d4,
-  0xc0d7d7c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xeac0d4e5,0xeaeaeaea,0xc0d4d0c0,0xc0d4e5d4,0xd7ebebd7,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xeac0d4e5,0xeaeaeaea,
-  0xd0d4c0ea,0xd7c0d4c0,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xc0d4d4d4,0xeaeaeaea,0xd4d4c0ea,0xd7c0c0d0,0xebebd7d7,
-  0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xc0d4d4c0,0xeaeaeaea,0xd4d0c0ea,0xd7d7c0d4,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xeaeaeaea,0xd4c0eaea,
-  0xebd7c0d4,0xebebebeb,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xeaeaeaea,0xd4c0eaea,0xebd7c0d4,0xd7ebebeb,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0c0c0c0,0xd4c0eaea,0xd7c0c0d4,0xc0d7d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xc0c0c0c0,0xc0c0c0d4,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xeaeaeac0,0xc0d5d5ea,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xeaead5c0,
-  0xd5d5eaea,0xc0c0c0c0,0xc0c0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xeaeac0c0,0xd5eaeaea,0xc0c0c0d5,0xc0c0d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0c0cc,0xead5c0c0,0xc0c0d5d5,0xc0d5d5c0,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xd5c0d5d5,
-  0xc0c0d5d5,0xd5d5d5c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xeaead5c0,0xeaeaeaea,0xc0c0c0d5,0xc0c0c0c0,0xccc0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,
-  0xeaeaead5,0xd5eaeaea,0xd5c0c0d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xeaead5d5,0xd5d5eaea,0xd5d5c0c0,
-  0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0cccc,0xd5d5d5c0,0xc0d5d5d5,0xd5d5d5c0,0xc0c0d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,
-  0xc0c0c0c0,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xc0c0cccc,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xd4c0c0c0,0xccccc0d4,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xd0c0d0c0,0xe5d4c0d0,0xccccc0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xc0d0d4d0,0xe5e5d4c0,0xccc0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4c0d4d4,0xc0e5d4c0,0xc0d7d7d7,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4d0c0c6,0xd4d4c0d4,
-  0xc0e5d4c0,0xd7ebebd7,0xccccc0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xd4c0c0c0,0xd4d4d4c0,0xc0d4c0d0,0xebebebd7,0xccc0d7eb,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xc0eaeac0,0xd4d4d0c0,0xc0c0d0d0,0xd7d7d7c0,0xc0d7d7d7,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xeac0d4e5,0xeaeaeaea,0xd4d0c0ea,0xccc0d0d4,
-  0xebd7c0cc,0xc0d7ebeb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xeac0d4e5,0xeaeaeaea,0xd4d0c0ea,0xc0d0d4d4,0xebd7c0cc,0xc0d7ebeb,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xeac0d4e5,0xeaeaeaea,
-  0xd0c0eaea,0xd0d4d4d4,0xebd7c0c0,0xc0d7ebeb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xeac0d4d4,0xeaeaeaea,0xd0c0eaea,0xd4d4d4d4,0xd7c0c0d0,
-  0xccc0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xc0c0c0c0,0xeaeac0c0,0xd0c0eaea,0xd4d4d4d0,0xc0c0d0d4,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xeac0c0d5,0xc0eaeaea,
-  0xd4d4d4d0,0xccc0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xeaead5c0,0xc0c0c0d5,0xc0eaeaea,0xd0d4d4d0,0xccccc0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xeaeaeac0,
-  0xc0c0d5d5,0xc0eaeac0,0xd0d0d4d0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xeaeaead5,0xc0d5d5ea,0xc0c0c0c0,0xc0c0d0d0,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xeaeaead5,0xc0d5d5ea,0xd4c0ccc0,0xc0d4c0c0,0xc0c0c0c0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xeaeaead5,0xead5d5ea,0xc0d5d5ea,
-  0xc0ccccc0,0xc0c0d4d4,0xd5d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xc0c0c0cc,0xeaead5c0,0xd5eaeaea,0xc0d5d5d5,0xc0ccccc0,0xd5c0c0c0,0xd5d5d5d5,
-  0xccc0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xd5c0c0c0,
-  0xeaeaeaea,0xc0c0c0d5,0xc0ccccc0,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xeaead5c0,0xc0c0d5ea,0xccccccc0,
-  0xd5d5c0c0,0xd5c0c0c0,0xc0c0c0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xd5c0c0c0,0xc0d5d5ea,0xcccccccc,0xc0c0c0c0,0xd5d5d5d5,0xc0c0d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,
-  0xc0d5d5d5,0xc0cccccc,0xd5d5c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccc0c0c0,0xc0cccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xc0c0c0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0c0cc,0xccccc0c0,0xc0cccccc,0xd5d5c0c0,0xc0c0d5d5,0xc0c0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xc0c0cccc,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xd4c0c0c0,0xccccc0d4,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xd4d4c0d0,0xccc0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xc0d0d4d0,0xe5d4d4c0,0xc0c0c0e5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4c0d4d4,0xe5e5d4c0,0xd7d7d7c0,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4d0c0c6,0xd4d4c0d4,
-  0xc0e5d4c0,0xebebebd7,0xc0c0d7d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xd4c0c0c0,0xd4d4d4c0,0xc0d4c0d0,0xebebd7d7,0xd7d7d7eb,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xc0eaeac0,0xd0d4d4d0,0xc0c0c0d0,0xebd7c0c0,0xebebd7d7,0xccccc0d7,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xc0c0d4e5,0xeaeaeaea,0xd4d4d0c0,0xccc0d0d0,
-  0xd7c0cccc,0xebebebd7,0xccccc0d7,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xeac0d4e5,0xeaeaeaea,0xd4d0c0ea,0xc0d0d4d4,0xc0cccccc,0xebebebd7,0xccccc0d7,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xeac0d4e5,0xeaeaeaea,
-  0xd4c0eaea,0xc0d0d4d4,0xc0cccccc,0xebebebd7,0xccccc0d7,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xeac0d4d4,0xeaeaeaea,0xd0c0eaea,0xd0d4d4d4,0xccccccc0,
-  0xd7d7d7c0,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xeac0d4c0,0xeaeaeaea,0xc0eaeaea,0xd4d4d4d4,0xccc0c0d0,0xc0c0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xeaeaeac0,0xc0eaeaea,
-  0xd4d4d4d4,0xc0d4c0d0,0xd5d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xeaeac0d5,0xc0eaeaea,0xd0d4d4d4,0xc0d4d4c0,0xd5d5d5d5,
-  0xc0c0d5d5,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5eaead5,
-  0xeaeac0d5,0xeaeaeaea,0xc0d0d0c0,0xd5c0d4d4,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xd5c0c0c0,0xeaeaeaea,0xeac0d5d5,0xc0c0c0ea,0xc0c0c0cc,
-  0xd5d5c0d4,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xeaeaead5,0xc0c0d5d5,0xccccccc0,0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xd5d5d5d5,
-  0xccccc0d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0c0,0xd5d5eaea,0xeaead5d5,0xccc0d5d5,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xccc0d5d5,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5c0c0cc,0xeaeaead5,0xead5d5d5,0xccc0d5d5,0xcccccccc,0xcccccccc,0xd5c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xccc0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xeaead5c0,
-  0xead5d5ea,0xccc0d5d5,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xd5d5d5d5,0xc0d5d5d5,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xead5c0c0,0xead5d5ea,0xccc0d5d5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0cccccc,0xd5c0c0c0,0xd5d5d5ea,0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,
-  0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xd5d5d5c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0c0cccc,0xd5d5c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5d5c0,
-  0xccc0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xccccc0c0,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xc0c0cccc,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0d0c0c0,0xd4d4c0c0,0xc0c0c0d4,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xd4d4d0c0,0xe5e5d4c0,0xd7d7c0d4,0xc0c0c0d7,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xc0d4d4d0,0xe5e5d4c0,0xebebd7c0,
-  0xd7d7d7eb,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0c0d4d4,0xe5e5d4c0,0xebd7d7c0,0xebebd7eb,0xccc0d7d7,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4c0c0c6,0xd0d0c0d4,
-  0xd4d4c0c0,0xd7c0c0c0,0xebebebd7,0xc0d7ebeb,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d4c0,0xc0c0c0d0,0xc0ccccc0,0xebebd7c0,
-  0xc0d7ebeb,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xeaeac0c0,0xd4c0c0ea,0xc0c0d4d4,0xcccccccc,0xebd7c0cc,0xc0d7ebeb,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xd0c0d4e5,0xeaeaeac0,0xc0eaeaea,0xd0d4d4d4,
-  0xccccc0c0,0xd7d7c0cc,0xccc0d7d7,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xd0c0d4e5,0xeaeaeac0,0xeaeaeaea,0xd4d4d4c0,0xc0c0d0d0,0xc0c0cccc,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xd0c0d4e5,0xeaeaeac0,
-  0xeaeaeaea,0xd4d4c0ea,0xd0d0d4d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xd0c0d4d4,0xeaeaeac0,0xeaeaeaea,0xd4d4c0ea,0xd0d4d4d4,
-  0xc0ccccc0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xd0c0d4c0,0xeaeaeac0,0xeaeaeaea,0xd0c0eaea,0xd0d4d4d4,0xd5c0ccc0,0xc0d5d5d5,0xccccccc0,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xeaeac0c0,0xeaeaeaea,
-  0xd0c0eaea,0xc0d0d4d4,0xd5d5c0cc,0xd5d5d5d5,0xccccc0d5,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xeac0d5d5,0xeaeaeaea,0xd0c0eaea,0xc0d0d0d4,0xd5d5d5c0,
-  0xd5d5d5d5,0xccc0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xd5d5d5c0,
-  0xc0d5d5ea,0xeaeaeaea,0xd0c0eaea,0xd4c0d0d0,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,
-  0xc0cccccc,0xc0cccccc,0xd5d5c0c0,0xd5d5d5d5,0xead5d5c0,0xc0d5eaea,0xeaeaeaea,0xc0eaeaea,
-  0xd4d4c0c0,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xc0cccccc,0xc0cccccc,0xead5c0c0,
-  0xd5d5eaea,0xeaead5d5,0xd5d5eaea,0xeaeaeac0,0xccc0c0ea,0xc0d4d4c0,0xd5d5d5d5,0xd5d5d5d5,
-  0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,0xd5c0c0c0,0xd5eaeaea,0xeaeaead5,0xd5d5eaea,
-  0xc0c0c0c0,0xccccccc0,0xd5c0d4c0,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xc0cccccc,
-  0xcccccccc,0xc0c0c0c0,0xeaeaead5,0xeaead5d5,0xc0d5d5ea,0xccccccc0,0xcccccccc,0xd5c0c0cc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xeaead5c0,
-  0xead5d5ea,0xc0c0d5d5,0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5c0c0c0,0xd5d5d5d5,0xd5d5d5d5,
-  0xccccccc0,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xead5c0c0,0xd5d5eaea,0xccc0d5d5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,
-  0xc0c0cccc,0xd5c0c0c0,0xd5d5d5ea,0xccc0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xd5c0c0cc,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,0xccccccc0,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xc0d5d5c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0c0c0cc,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccc0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0d4c0d4,0xccc0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xc0d0d4d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xc0d4d0c0,0xd0c0c0c0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xd0d0c0c0,0xd4c0d4d4,0xc0d4d4d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xc0c0d4e5,0xc0c0d7d7,0xd4c0c0c0,0xd4e5e5e5,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xd7d7c0e5,0xd7d7ebeb,0xc0d7d7d7,0xe5e5d4d4,0xccccc0d4,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xebd7c0e5,0xebebebeb,
-  0xd7ebebeb,0xd4d4c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xebd7c0d4,0xebebebeb,0xd7d7ebeb,0xc0c0c0d7,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xd7c0d4c0,0xd7d7d7d7,0xc0d7d7d7,0xd4c0c0c0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xd4c0c0c0,
-  0xd4d4d4d4,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd4d4c0c0,0xd0d4d4d4,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xd4d4c0d5,0xc0d0d0d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xd0d0d0c0,0xd5c0c0d0,
-  0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0c0c0,0xd5d5d5c0,0xc0c0d5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xc0d5d5d5,
-  0xd5d5d5d5,0xeaead5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xc0d5d5d5,0xead5d5d5,0xeaeaeaea,0xd5d5d5d5,
-  0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xd5c0cccc,0xd5d5d5d5,0xd5d5d5c0,0xeaeaeaea,0xd5d5d5ea,0xccc0d5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5c0d5,
-  0xd5d5d5d5,0xead5d5d5,0xccc0d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xc0c0d5d5,0xd5d5d5c0,0xeaead5d5,0xccc0d5d5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,
-  0xd5d5d5d5,0xc0c0c0d5,0xead5d5d5,0xd5eaeaea,0xccc0d5d5,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xc0ccc0d5,0xeaead5d5,
-  0xd5eaeaea,0xccccc0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xc0ccccc0,0xeaead5d5,0xd5d5eaea,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,
-  0xcccccccc,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccc0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd4d4c0d4,0xccc0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xc0d0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xc0d4d4c0,0xd0d4c0c0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xd4d0d0c0,0xd4c0d4d4,0xd0c0d4d4,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7d7,0xc0d0d4e5,0xd0d0c0ea,0xd4c0c0d0,0xc0d4e5e5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xc0d7ebeb,0xc0d0d4e5,0xc0d0c0ea,0xc0d7d7c0,0xd4e5e5d4,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xc0d7d7eb,0xc0d0d4e5,0xd7c0c0c0,
-  0xd7ebebd7,0xc0d4d4c0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xc0d7d7d7,0xc0c0d4d4,0xebd7d7d7,0xd7ebebeb,0xd0c0c0d7,0xccc0d0d4,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xccc0c0c0,
-  0xc0ccc0c0,0xebebebd7,0xc0d7d7eb,0xd4d4d4c0,0xccc0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7ebebd7,0xd0c0c0d7,
-  0xd4d4d4d4,0xccc0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0d7d7c0,0xd0d0c0c0,0xd4d4d4d4,0xccc0d0d4,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xeac0c0c0,0xd0d0c0ea,0xd0d0d0d0,0xc0c0c0d0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xeaeaeac0,0xc0c0c0ea,0xc0c0c0c0,
-  0xd5d5c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5c0cccc,0xc0c0c0c0,0xc0c0c0c0,0xc0d5d5d5,0xd5d5d5c0,0xccc0c0d5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xc0c0d5d5,
-  0xd5c0c0c0,0xd5d5d5d5,0xeaeac0d5,0xccc0d5ea,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0d5d5d5,0xd5c0c0c0,0xeaeaeaea,0xeaeaeaea,
-  0xc0d5eaea,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd5d5d5c0,0xc0c0c0c0,0xeaeaead5,0xeaeaeaea,0xc0ead5d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xc0c0c0d5,
-  0xead5d5c0,0xc0d5eaea,0xd5ead5c0,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5d5c0c0,0xc0c0d5d5,0xc0c0c0c0,0xd5c0c0d5,0xd5eaead5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,
-  0xd5d5d5d5,0xc0c0d5d5,0xc0ccc0c0,0xd5d5c0c0,0xd5eaeaea,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccc0c0,
-  0xd5c0c0cc,0xd5eaead5,0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5d5c0,0xc0c0d5d5,0xc0c0c0c0,0xccccc0c0,0xc0c0cccc,0xd5d5d5d5,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,
-  0xc0c0c0c0,0xccccccc0,0xcccccccc,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccc0d0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0d4c0d4,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd0d0c0c6,0xd4d4d4c0,
-  0xccc0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c6,0xc6c6c6c6,0xc0c0c0c0,0xd4d4d0c0,0xccc0d0d0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0c0c0c0,0xc0c0c0c0,
-  0xd4d4c0c0,0xd4d4c0d4,0xc0d0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebebd7,0xd7d7c0d7,0xc0c0c0d7,0xe5d4c0c0,0xd4d4c0d4,0xc0d4c0d4,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebeb,
-  0xebebd7c0,0xd7d7d7eb,0xd4c0d7d7,0xd4c0d4e5,0xd4d0d0c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebebd7,0xebebd7c0,0xebebebeb,0xd4c0d7eb,
-  0xc0c0d4e5,0xd4d4d4d0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xebebd7c0,0xebebebeb,0xd4c0d7eb,0xd0c0d4d4,0xd4d4d4d0,0xccccc0d4,
-  0xc0cccccc,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xd7d7c0c0,
-  0xd7d7d7d7,0xc0c0c0d7,0xd0d0c0c0,0xd4d4d4d4,0xccc0d0d4,0xc0c0c0cc,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,0xeaeaeac0,0xd4d0c0ea,
-  0xd4d4d4d4,0xccc0d4d4,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0c0c0c0,0xeaeac0c0,0xd4d0c0ea,0xd4d4d4d4,0xc0c0d0d4,0xd5d5c0c0,
-  0xc0d5c0c0,0xccccccc0,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,
-  0xeac0c0c0,0xd4d0c0ea,0xd0d4d4d4,0xc0d4c0d0,0xd5d5c0c0,0xd5d5c0d5,0xccccc0c0,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xd5d5c0c0,0xc0c0c0d5,0xd4c0c0c0,0xc0d0d0d4,
-  0xc0e5e5c0,0xead5c0c0,0xd5eac0d5,0xccc0c0d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xd5d5c0c0,0xc0c0d5d5,0xc0ccccc0,0xd4c0c0c0,0xc0e5e5e5,0xeaead5c0,0xeaead5d5,
-  0xc0c0d5d5,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0cccc,0xd5c0c0c0,0xc0d5d5d5,
-  0xccccccc0,0xc0cccccc,0xc0e5e5d4,0xeaead5c0,0xeaeac0d5,0xc0d5d5ea,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xd5d5c0c0,0xc0d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xc0e5d4c0,
-  0xeaead5c0,0xeaeac0d5,0xc0d5eaea,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5d5,
-  0xd5d5d5d5,0xd5d5d5c0,0xccccc0c0,0xcccccccc,0xc0c0c0cc,0xeaeaeac0,0xead5c0c0,0xc0d5eaea,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5c0c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccc0c0,
-  0xcccccccc,0xc0c0c0cc,0xc0eaeaea,0xc0c0c0c0,0xccc0c0c0,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xd5d5d5c0,0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xc0c0cccc,0xc0c0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xd5c0c0c0,
-  0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,0xc0c0d5c0,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xc0c0c0c0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccc0d0d4,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xc0c0c0c6,0xd4d0c0c0,0xc0d0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4d4d4c0,0xd4d4d0c0,
-  0xc0d0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c0c0c6,0xc0c0c6c6,0xd4e5d4c0,0xd4d4d0c0,0xd0d4c0d4,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7d7d7,0xc0d7d7c0,0xd7d7c0c0,
-  0xe5e5d4c0,0xc0d4c0d4,0xd4d4d0c0,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xc0ebebd7,0xd7ebebd7,0xebebd7d7,0xe5e5c0d7,0xd0c0c0d4,0xd4d4d4d0,
-  0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xc0ebebeb,
-  0xebebebd7,0xebebebeb,0xd4d4c0d7,0xd0d0c0d4,0xd4d4d4d0,0xccc0d0d4,0xcccccccc,0xc0c0c0cc,
-  0xccccccc0,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xc0ebebd7,0xebebd7d7,0xd7d7ebeb,0xc0c0c0c0,
-  0xd0d0c0c0,0xd4d4d4d4,0xccc0d0d4,0xc0c0cccc,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xc0cccccc,
-  0xc0cccccc,0xd7d7d7d7,0xd7d7d7c0,0xc0c0d7d7,0xeaeaeac0,0xd4d0c0ea,0xd4d4d4d4,0xc0c0d4d4,
-  0xc0c0c0c0,0xd5d5c0c0,0xccc0c0c0,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,
-  0xc0c0c0c0,0xeaeac0d4,0xd4d0c0ea,0xd4d4d4d4,0xc0c0d0d4,0xd5c0c0c0,0xead5d5d5,0xc0c0d5d5,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0d5d5d5,0xeac0d4d4,0xd4d0c0ea,
-  0xd0d4d4d4,0xc0c0c0d0,0xeaead5c0,0xeaead5ea,0xc0c0d5ea,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xd5c0cccc,0xc0c0d5d5,0xc0d4d4c0,0xd4c0c0c0,0xc0d0d0d4,0xc0d4e5c0,0xeaeaead5,
-  0xead5d5ea,0xc0d5eaea,0xccccccc0,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0cccc,0xc0d5d5d5,
-  0xc0d4c0c0,0xc0ccccc0,0xe5c0c0c0,0xc0d4e5e5,0xeaead5d5,0xd5c0d5ea,0xd5d5eaea,0xccccccc0,
-  0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xd5d5c0c0,0xc0d5d5d5,0xccc0c0c0,0xcccccccc,0xd4c0cccc,
-  0xc0d4d4d4,0xeaead5c0,0xd5c0d5d5,0xd5eaeaea,0xccccc0c0,0xc0cccccc,0xc0cccccc,0xd5d5d5c0,
-  0xd5d5d5d5,0xc0d5d5d5,0xccccc0c0,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xd5c0c0c0,
-  0xd5eaeaea,0xccccc0c0,0xc0cccccc,0xc0cccccc,0xd5c0c0c0,0xc0d5d5d5,0xc0d5d5c0,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xd5d5ead5,0xccccc0c0,0xc0cccccc,
-  0xc0cccccc,0xc0c0c0c0,0xd5d5d5d5,0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccc0c0,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xd5d5d5c0,
-  0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,
-  0xccccccc0,0xc0cccccc,0xcccccccc,0xc0c0c0cc,0xd5d5c0c0,0xc0c0c0d5,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0cccc,0xd5c0c0c0,0xc0c0c0d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5c0c0c0,0xc0c0c0c0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xc0c0c0cc,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xccccc0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,0xd5d5d5d5,
-  0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,
-  0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xc0c0d5d5,
-  0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,0xd7d7ebff,
-  0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xffead5eb,0xebebebff,0xd7ebebd7,0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,0xc6c6d7d7,
-  0xc0d0d0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xd0c0d0d0,0xccccccc0,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,0xebd7c6eb,
-  0xd7d7ebeb,0xd0c0c6c6,0xd0d4c0d4,0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xc0d0c0c6,0xd4d4d4c0,
-  0xccccc0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0c0c0,0xc6c6c6c0,0xc6c6c6c6,0xd4c0c0c0,0xc0d4d4d4,0xccc0d0d0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xd7d7c0d7,0xc0c0c0d7,0xc0c0c0c0,
-  0xd4d4c0c0,0xc0d4d4d4,0xc0d0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd7c0cccc,0xebebd7c0,0xc0c0d7eb,0xd4d4c0c0,0xd4d4c0d4,0xd0c0d0d4,0xd0d0d4d0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebd7c0,
-  0xd7d7ebeb,0xe5d4c0d7,0xd4d0c0d4,0xd0d0c0d0,0xd0d4d4d4,0xccccc0d0,0xcccccccc,0xc0c0c0cc,
-  0xccc0c0c0,0xcccccccc,0xc0cccccc,0xd7c0cccc,0xebebd7c0,0xebebebeb,0xe5d4c0d7,0xd0c0c0d4,
-  0xd0d0d0c0,0xd4d4d4d4,0xccc0d0d0,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xccccccc0,0xc0cccccc,
-  0xc0cccccc,0xd7d7c0d7,0xd7d7d7d7,0xe5d4c0d7,0xc0c0c0d4,0xd4d0d0d0,0xd4d4d4d4,0xc0c0d0d4,
-  0xc0cccccc,0xd5d5c0c0,0xc0d5ead5,0xccc0c0c0,0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,
-  0xd4c0c0c0,0xc0d4c0c0,0xd4d4d0c0,0xd4d4d4d4,0xd4d4c0d0,0xc0c0ccc0,0xeaead5c0,0xd5eaead5,
-  0xc0c0c0d5,0xc0cccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xd4d4d4c0,0xd4d0d0c0,
-  0xd0d4d4d4,0xd4e5c0d0,0xc0c0c0d4,0xeaead5d5,0xeaead5d5,0xc0d5d5ea,0xc0ccccc0,0xc0c0c0cc,
-  0xccccc0c0,0xcccccccc,0xd5d5c0c0,0xd4d4d4c0,0xd4d0c0d4,0xd0d0d4d4,0xe5e5d4c0,0xd5d5c0c0,
-  0xeaeaead5,0xead5d5d5,0xd5d5eaea,0xc0ccc0c0,0xd5d5c0c0,0xc0c0d5d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xd4d4c0d5,0xd0d0c0c0,0xd0d0d0d4,0xd4e5d4c0,0xd5d5d5c0,0xd5eaeaea,0xd5d5c0c0,0xd5eaeaea,
-  0xc0c0c0d5,0xd5c0c0c0,0xd5d5d5d5,0xd5d5c0c0,0xd5d5d5d5,0xc0c0c0c0,0xd0d0c0cc,0xc0c0d0d0,
-  0xc0d4c0cc,0xead5d5c0,0xd5d5eaea,0xd5c0c0c0,0xd5d5d5d5,0xc0c0c0d5,0xc0c0c0c0,0xd5d5d5d5,
-  0xd5d5d5d5,0xd5d5d5d5,0xccccc0c0,0xc0c0c0cc,0xccccc0c0,0xc0c0cccc,0xead5c0c0,0xc0c0d5ea,
-  0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xd5d5d5c0,0xd5d5d5d5,0xc0d5d5d5,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xc0ccccc0,0xc0c0c0c0,0xc0ccccc0,
-  0xc0c0c0cc,0xd5d5c0c0,0xd5d5d5d5,0xc0c0d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0c0c0c0,0xccccc0c0,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0cc,0xd5d5c0c0,0xc0d5d5d5,
-  0xc0c0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0cccc,0xd5c0c0c0,0xc0d5d5d5,0xccc0c0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0cccc,
-  0xc0c0c0c0,0xc0c0d5d5,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0cccccc,0xc0c0c0c0,0xc0c0c0d5,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0c0cc,
-  0xccc0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xccccc0c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0c0c0,0xccccccc0,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xd5c0c0c0,
-  0xd5d5d5d5,0xc0ccc0d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xc0c0d5d5,0xccc0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xc0c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xd5c0d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,
-  0xd5d5d5d5,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,
-  0xc0c0d5d5,0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0cc,0xd5d5c0d5,0xd5c0c0d5,0xc0c0c0c0,
-  0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xd5c0cccc,0xffeac0d5,0xc0c0d7eb,0xd7d7d7c0,0xc0d5d5c0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd5c0cccc,0xffeac0c0,
-  0xd7d7ebff,0xd7ebebc0,0xc0c0d5c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xffeac0eb,0xd7ebebff,0xd7ebebd7,0xccc0c0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xd7c6cccc,0xffead5eb,0xebebebff,0xd7ebebd7,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xebc6cccc,0xffffffeb,0xebebebeb,
-  0xc6c6d7d7,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xebc6cccc,0xc6c6ebeb,0xd7ebebeb,0xc0c6c6d7,0xc0c0d0d0,0xccccc0c0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xd7c6cccc,
-  0xebd7c6eb,0xd7d7ebeb,0xd4c0c6c6,0xc0d0d0d4,0xccc0d0d0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc6cccccc,0xebebebd7,0xc6c6d7d7,0xd4c0c6c6,
-  0xd4c0d0d4,0xc0d0d0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xcccccccc,0xc6c6c6c6,0xc6c6c6c6,0xd4c0c6c6,0xd4c0d4d4,0xc0d0d0d4,0xccccccc0,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,
-  0xc0c0c0c0,0xc0c0c6c6,0xd4c0c0c0,0xd4c0c0d4,0xccccc0c0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xc0c0c0cc,0xc0c0c0c0,0xc0c0e5c0,0xeaeac0d4,0xc0eac0c0,0xd4c0d0d0,
-  0xe5e5d4c0,0xccc0d4d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xebd7d7c0,
-  0xd7d7ebeb,0xc0d4e5c0,0xeaeac0d4,0xc0eaeaea,0xc0c0d0d0,0xe5e5e5d4,0xccc0d4e5,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xebebd7c0,0xd7ebebeb,0xc0d4e5c0,0xeaeac0d4,
-  0xc0eaeaea,0xc0d0d0d0,0xe5e5e5e5,0xccc0c0d4,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xebd7d7c0,0xd7ebebeb,0xc0d4e5c0,0xeaeac0d4,0xeaeaeaea,0xc0d0d0c0,0xc0d4e5d4,
-  0xc0d7d7c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xd7d7d7c0,0xd7d7d7d7,
-  0xc0d4e5c0,0xeaeac0d4,0xeaeaeaea,0xc0d0d0c0,0xd7c0d4d4,0xc0ebebd7,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xd7d7c0cc,0xc0c0c0d7,0xc0d4d4c0,0xeac0d0d4,0xeaeaeaea,
-  0xd0d0d0c0,0xc0ccc0c0,0xebebd7d7,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xc0c0cccc,0xccccccc0,0xc0c0c0cc,0xeac0d0d4,0xeaeaeaea,0xd0d0d0c0,0xccccccc0,0xebd7d7c0,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xeac0d0d4,0xeaeaeaea,0xd0d0c0ea,0xc0ccc0d0,0xebebd7d7,0xccccc0eb,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xeac0d0d4,0xeaeaeaea,0xd0d0c0ea,
-  0xc0c0d0d0,0xebebebd7,0xccccc0eb,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,
-  0xcccccccc,0xd0c0cccc,0xeac0c0d0,0xeaeaeaea,0xd0c0eaea,0xd7c0d0d0,0xebebd7d7,0xccccc0eb,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xc0c0c0cc,0xeaeaeac0,
-  0xeaeaeaea,0xc0eaeaea,0xc0c0c0c0,0xd7d7d7d7,0xccccccc0,0xcccccccc,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xcccccccc,0xcccccccc,0xd5d5c0cc,0xeac0c0d5,0xeaeaeaea,0xc0c0eaea,0xd5d5d5d5,
-  0xc0c0c0c0,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,
-  0xead5d5c0,0xc0d5d5d5,0xc0c0c0c0,0xd5d5c0c0,0xd5d5eaea,0xccccc0d5,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xcccccccc,0xeaead5c0,0xd5d5d5ea,0xccccccc0,
-  0xead5c0cc,0xd5eaeaea,0xccc0d5d5,0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,
-  0xcccccccc,0xc0cccccc,0xeaead5d5,0xd5d5d5ea,0xccccccc0,0xead5c0cc,0xd5eaeaea,0xc0d5d5d5,
-  0xcccccccc,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xcccccccc,0xc0c0cccc,0xead5d5d5,
-  0xd5d5d5ea,0xccccc0d5,0xead5c0cc,0xd5eaeaea,0xd5d5d5d5,0xccccccc0,0xcccccccc,0xcccccccc,
-  0xcccccccc,0xc0cccccc,0xcccccccc,0xd5d5c0c0,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,0xd5c0cccc,
-  0xd5d5eaea,0xd5d5d5d5,0xccc0c0d5,0xcccccccc,0xcccccccc,0xcccccccc,0xc0cccccc,0xc0c0cccc,
-  0xead5d5d5,0xd5eaeaea,0xd5d5d5d5,0xccccc0d5,0xd5c0cccc,0xd5d5d5d5,0xd5d5d5d5,0xc0d5d5d5,
-  0xccccccc0,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5c0cc,0xeaeaead5,0xd5d5eaea,0xd5d5d5d5,
-  0xccccc0d5,0xd5c0cccc,0xd5d5d5d5,0xeaeaead5,0xd5d5d5ea,0xccc0c0d5,0xcccccccc,0xcccccccc,
-  0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xccccc0d5,0xc0cccccc,0xd5d5d5d5,
-  0xeaeaeaea,0xd5d5eaea,0xc0d5d5d5,0xcccccccc,0xcccccccc,0xc0cccccc,0xd5d5d5c0,0xd5d5d5d5,
-  0xd5d5d5d5,0xd5d5d5d5,0xccccccc0,0xc0cccccc,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,0xd5d5d5d5,
-  0xccccccc0,0xcccccccc,0xc0cccccc,0xc0c0c0cc,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xcccccccc,
-  0xc0cccccc,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xc0c0c0c0,0xccccccc0,0xcccccccc,0xc0cccccc,
 };
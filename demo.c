@@ -0,0 +1,186 @@
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+#include "vga_6bit.h"
+#include "vga_font.h"
+#include "vga_draw.h"
+#include "vga_prof.h"
+#include "demo.h"
+
+#include "data/font6x8.h"
+#include "data/loserboy.h"
+#include "data/tiles.h"
+
+#define NUM_SPRITES   30 // number of sprites to draw
+
+struct CHARACTER {
+  struct SPRITE *sprite;
+  int message_index;
+  int x;
+  int y;
+  int dx;
+  int dy;
+  int frame;
+  int message_frame;
+};
+
+static struct SPRITE char_frames[img_loserboy_num_spr];
+static struct CHARACTER characters[NUM_SPRITES];
+
+#define loserboy_stand_frame        10
+#define loserboy_walk_frame_delay   4
+static const unsigned int loserboy_walk_cycle[] = {
+  5, 6, 7, 8, 9, 8, 7, 6, 5, 0, 1, 2, 3, 4, 3, 2, 1, 0,
+};
+static const unsigned char bg_map[20] = {
+  0,0,0,0,0,
+  0,0,1,0,0,
+  0,1,0,1,0,
+  0,0,0,0,0,
+};
+
+static unsigned int (*get_random)(void);
+
+static const char *loserboy_messages[] = {
+  "I'll get you!",
+  "Come back here!",
+  "Ayeeeee!",
+  "You can't escape!",
+  "Take this!",
+};
+
+static void init_sprites(void)
+{
+  for (int i = 0; i < count_of(char_frames); i++) {
+    struct SPRITE *spr = &char_frames[i];
+    spr->width  = img_loserboy_width;
+    spr->height = img_loserboy_height;
+    spr->stride = img_loserboy_stride;
+    spr->data   = &img_loserboy_data[i*img_loserboy_stride*img_loserboy_height];
+  }
+
+  for (int i = 0; i < NUM_SPRITES; i++) {
+    struct CHARACTER *ch = &characters[i];
+    ch->x = get_random() % (vga_screen.width  - img_loserboy_width);
+    ch->y = get_random() % (vga_screen.height - img_loserboy_height);
+    ch->dx = (1 + get_random() % 3) * ((get_random() & 1) ? -1 : 1);
+    ch->dy = (1 + get_random() % 2) * ((get_random() & 1) ? -1 : 1);
+    ch->frame = i + i*loserboy_walk_frame_delay;
+    ch->sprite = &char_frames[loserboy_stand_frame];
+    ch->message_index = -1;
+    ch->message_frame = -1;
+  }
+}
+
+static const struct TILEMAP bg_tilemap = {
+  5, 4, bg_map, img_tiles_data,
+};
+
+// Draw a rectangle of the background
+static void draw_background(int x, int y, int width, int height)
+{
+  draw_tilemap_rect(&bg_tilemap, 0, 0, x, y, width, height);
+}
+
+static void move_character(struct CHARACTER *ch)
+{
+  if (ch->message_frame-- < 0) {
+    ch->message_index = -1;
+    ch->message_frame = 600 + get_random() % 1200;
+  } else if (ch->message_frame == 180) {
+    ch->message_index = get_random() % count_of(loserboy_messages);
+  }
+
+  if (ch->message_frame > 1500) {
+    ch->sprite = &char_frames[loserboy_stand_frame];
+  } else {
+    ch->x += ch->dx;
+    if (ch->x <  -ch->sprite->width/2)                   ch->dx =   1 + get_random() % 3;
+    if (ch->x >= vga_screen.width-ch->sprite->width/2)   ch->dx = -(1 + get_random() % 3);
+    
+    ch->y += ch->dy;
+    if (ch->y <  -ch->sprite->height/2)                  ch->dy =   1 + get_random() % 2;
+    if (ch->y >= vga_screen.height-ch->sprite->height/2) ch->dy = -(1 + get_random() % 2);
+    
+    ch->frame++;
+    if (ch->frame/loserboy_walk_frame_delay >= count_of(loserboy_walk_cycle)) {
+      ch->frame = 0;
+    }
+    int frame_num = loserboy_walk_cycle[ch->frame/loserboy_walk_frame_delay];
+    ch->sprite = &char_frames[frame_num];
+  }
+}
+
+void demo_init(unsigned int (*rand_func)(void))
+{
+  get_random = rand_func;
+
+  font_set_font(&font6x8);
+  font_set_color(0x3f);
+  init_sprites();
+
+  // only redraw the background where something was drawn
+  draw_set_background_func(draw_background);
+}
+
+void demo_frame(int fps)
+{
+  int scope = prof_begin("logic");
+  for (int i = 0; i < NUM_SPRITES; i++) {
+    move_character(&characters[i]);
+  }
+  prof_end(scope);
+
+  // restore the background over what was drawn in this framebuffer
+  scope = prof_begin("background");
+  draw_restore_background();
+  prof_end(scope);
+
+#if VGA_ENABLE_MULTICORE
+  // record the drawing below, then draw it with both cores
+  draw_list_begin(true);
+#endif
+
+  // draw sprites
+  scope = prof_begin("sprites");
+  int msg_index = -1;
+  int msg_x, msg_y;
+  for (int i = 0; i < NUM_SPRITES; i++) {
+    struct CHARACTER *ch = &characters[i];
+    // the frames face right, mirror them when walking left
+    draw_sprite(ch->sprite, ch->x, ch->y, DRAW_TRANSPARENT | ((ch->dx < 0) ? DRAW_FLIP_H : 0));
+    if (ch->message_index >= 0) {
+      msg_x = ch->x + ch->sprite->width/2;
+      msg_y = ch->y - 10;
+      msg_index = ch->message_index;
+    }
+  }
+  prof_end(scope);
+
+  scope = prof_begin("text");
+  if (msg_index >= 0) {
+    font_align(FONT_ALIGN_CENTER);
+    font_move(msg_x, msg_y);
+    font_print_cached(loserboy_messages[msg_index]);
+  }
+
+  // draw fps counter
+  font_align(FONT_ALIGN_LEFT);
+  font_move(10, 10);
+  char fps_text[16];
+  snprintf(fps_text, sizeof(fps_text), "%d fps", fps);
+  font_print_cached(fps_text);
+  prof_end(scope);
+
+#if VGA_ENABLE_MULTICORE
+  scope = prof_begin("draw list");
+  draw_list_end();
+  prof_end(scope);
+#endif
+
+#if VGA_ENABLE_PROFILER
+  // times of the previous frame
+  prof_draw_overlay(10, vga_screen.height - 50, 200);
+#endif
+}
@@ -0,0 +1,21 @@
+#ifndef DEMO_H_FILE
+#define DEMO_H_FILE
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// The demo's frame composition, without the hardware: characters
+// walking over the background with messages and an fps counter.
+// demo_init() needs the screen initialized and takes the random number
+// generator used to move the characters (so the host build can make it
+// deterministic); demo_frame() moves the characters and draws them in
+// the framebuffer being drawn, which is then ready to swap.
+void demo_init(unsigned int (*rand_func)(void));
+void demo_frame(int fps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DEMO_H_FILE */
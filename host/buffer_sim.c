@@ -0,0 +1,167 @@
+/**
+ * buffer_sim.c
+ *
+ * Runs the VGA driver with triple buffering on the host and checks
+ * which frames the monitor gets with each frame policy: each submitted
+ * frame is filled with its own color, and the color sent to the PIO
+ * between two DMA interrupts tells which framebuffer was shown.  Also
+ * checks that vga_acquire_back_buffer() and vga_swap_buffers() never
+ * return a buffer that's shown or waiting to be shown, and that
+ * dropped buffers are reused.
+ *
+ * Usage: buffer_sim latest|fifo
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "host_sdk.h"
+
+#define NUM_COLORS 8
+
+static unsigned char last_color;
+static unsigned int *color_buffer[NUM_COLORS];   // framebuffer drawn with each color
+static int errors;
+
+static void pio_tx(PIO pio, uint sm, uint32_t data)
+{
+  (void) pio;
+  (void) sm;
+  for (int i = 0; i < 4; i++) {
+    if ((data >> (8*i)) & 0x3f) last_color = (data >> (8*i)) & 0x3f;
+  }
+}
+
+static void draw(unsigned char color)
+{
+  for (int y = 0; y < vga_screen.height; y++) {
+    memset(vga_screen.framebuffer[y], vga_screen.sync_bits | color, vga_screen.width);
+  }
+  color_buffer[color] = vga_screen.framebuffer[0];
+}
+
+// Run the DMA until the next interrupt, return the color of the frame
+// shown since the previous one
+static int next_frame(void)
+{
+  struct VGA_STATS stats;
+  vga_get_stats(&stats);
+  unsigned int start = stats.frames;
+  last_color = 0;
+  while (stats.frames == start) {
+    if (! host_dma_step()) {
+      printf("DMA chain stopped\n");
+      exit(1);
+    }
+    vga_get_stats(&stats);
+  }
+  return last_color;
+}
+
+static void check_frames(const char *what, const int *expected, int num_frames)
+{
+  for (int i = 0; i < num_frames; i++) {
+    int color = next_frame();
+    if (color != expected[i]) {
+      printf("%s: frame %d has color %d, expected %d\n", what, i, color, expected[i]);
+      errors++;
+    }
+  }
+}
+
+// the buffer being drawn must not be the one with any of the colors
+static void check_buffer(const char *what, const int *colors, int num_colors)
+{
+  for (int i = 0; i < num_colors; i++) {
+    if (vga_screen.framebuffer[0] == color_buffer[colors[i]]) {
+      printf("%s: got the buffer with color %d\n", what, colors[i]);
+      errors++;
+    }
+  }
+}
+
+static void check_acquire(const char *what, bool expected)
+{
+  if (vga_acquire_back_buffer() != expected) {
+    printf("%s: vga_acquire_back_buffer() returned %s\n", what, (expected) ? "false" : "true");
+    errors++;
+  }
+}
+
+// Frames 1 and 2 wait behind the shown (blank) buffer; 1 is dropped
+// and its buffer reused to draw 3, which replaces 2
+static void check_latest(void)
+{
+  draw(1);
+  vga_submit_frame();
+  check_acquire("latest", true);
+  draw(2);
+  vga_submit_frame();
+  check_acquire("latest", true);
+  if (vga_screen.framebuffer[0] != color_buffer[1]) {
+    printf("latest: the buffer of the dropped frame was not reused\n");
+    errors++;
+  }
+  draw(3);
+  vga_submit_frame();
+  static const int expected[] = { 0, 3, 3 };
+  check_frames("latest", expected, 3);
+}
+
+// Frames 1 and 2 wait behind the shown (blank) buffer, so there's no
+// buffer to draw 3 until the blank one is no longer shown
+static void check_fifo(void)
+{
+  draw(1);
+  vga_submit_frame();
+  check_acquire("fifo", true);
+  draw(2);
+  vga_submit_frame();
+  check_acquire("fifo, two frames waiting", false);
+  static const int expected_1[] = { 0 };
+  check_frames("fifo", expected_1, 1);
+  check_acquire("fifo", true);
+  check_buffer("fifo", (const int []) { 1, 2 }, 2);
+  draw(3);
+  vga_submit_frame();
+  static const int expected_2[] = { 1, 2, 3, 3 };
+  check_frames("fifo", expected_2, 4);
+}
+
+// Swapping without waiting for sync while frame 3 is shown: the new
+// buffer must be neither the shown nor the queued one
+static void check_swap(void)
+{
+  check_acquire("swap", true);
+  draw(4);
+  vga_swap_buffers(false);
+  check_buffer("swap", (const int []) { 3, 4 }, 2);
+  draw(5);
+  vga_swap_buffers(false);
+  check_buffer("swap", (const int []) { 3, 5 }, 2);
+  static const int expected[] = { 3, 5 };
+  check_frames("swap", expected, 2);
+}
+
+int main(int argc, char *argv[])
+{
+  bool fifo = (argc > 1 && strcmp(argv[1], "fifo") == 0);
+
+  host_pio_set_tx_func(pio_tx);
+  if (vga_init_triple_buffer(&vga_mode_320x240, 2, (fifo) ? VGA_FRAME_FIFO : VGA_FRAME_LATEST) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+
+  if (fifo) {
+    check_fifo();
+  } else {
+    check_latest();
+  }
+  check_swap();
+
+  printf("triple buffering, %s: %s\n", (fifo) ? "fifo" : "latest", errors ? "FAILED" : "OK");
+  return errors != 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * canvas_sim.c
+ *
+ * Runs the VGA driver with a virtual canvas on the host and checks
+ * the address each visible line is read from by the DMA chain: lines
+ * must come from the window at the scroll origin (wrapping around the
+ * bottom of the canvas), except for lines set with
+ * vga_set_line_source(), and vga_reset_line_sources() must go back to
+ * the window at the scroll origin.  Also checks that setting the
+ * scroll before the driver is initialized is ignored.
+ *
+ * Usage: canvas_sim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "host_sdk.h"
+
+#define CANVAS_WIDTH  640
+#define CANVAS_HEIGHT 480
+
+static const struct VGA_MODE *mode = &vga_mode_320x240;
+
+static const void *line_src[1024];   // source of each visible line of the last frame
+static int num_lines;
+static unsigned int source_data[CANVAS_WIDTH / 4];
+static int errors;
+
+static void pio_read(PIO pio, uint sm, const void *src, uint32_t count)
+{
+  (void) pio;
+  (void) sm;
+  // only pixel blocks have the length of a visible line
+  if (count == mode->h_pixels / 4u && num_lines < (int) count_of(line_src)) {
+    line_src[num_lines++] = src;
+  }
+}
+
+// Run the DMA until the next interrupt, which comes after the visible
+// lines of the frame shown since the previous one
+static void next_frame(void)
+{
+  struct VGA_STATS stats;
+  vga_get_stats(&stats);
+  unsigned int start = stats.frames;
+  num_lines = 0;
+  while (stats.frames == start) {
+    if (! host_dma_step()) {
+      printf("DMA chain stopped\n");
+      exit(1);
+    }
+    vga_get_stats(&stats);
+  }
+}
+
+// Check the frame shown next: it must come from the window at (x, y)
+// of the canvas, except for screen line src_line, read from src
+static void check_frame(const char *what, unsigned int **canvas, int x, int y, int src_line, const void *src)
+{
+  next_frame();
+  if (num_lines != mode->v_pixels) {
+    printf("%s: %d visible lines, expected %d\n", what, num_lines, mode->v_pixels);
+    errors++;
+    return;
+  }
+  for (int i = 0; i < num_lines; i++) {
+    int line = i / mode->v_div;
+    const void *expected = (line == src_line) ? src : canvas[(y + line) % CANVAS_HEIGHT] + x/4;
+    if (line_src[i] != expected) {
+      printf("%s: screen line %d is not read from %s\n", what, line, (line == src_line) ? "its source" : "the window");
+      errors++;
+      return;
+    }
+  }
+  printf("%s: OK\n", what);
+}
+
+int main(void)
+{
+  // canvas_height is 0 before init
+  vga_set_scroll(4, 4);
+
+  host_pio_set_read_func(pio_read);
+  if (vga_init_virtual(mode, 2, CANVAS_WIDTH, CANVAS_HEIGHT, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+
+  // x is rounded down to 100, y wraps to 300 (and then around the
+  // bottom of the canvas)
+  unsigned int **a = vga_screen.framebuffer;
+  vga_set_scroll(101, -180);
+  vga_swap_buffers(true);
+  check_frame("scroll, first buffer", a, 100, 300, -1, NULL);
+
+  unsigned int **b = vga_screen.framebuffer;
+  vga_swap_buffers(true);
+  check_frame("scroll, second buffer", b, 100, 300, -1, NULL);
+
+  vga_set_line_source(10, source_data);
+  vga_swap_buffers(true);
+  check_frame("line source", a, 100, 300, 10, source_data);
+
+  // the chain of b is already at the scroll origin, so the IRQ
+  // handler won't set it again
+  vga_reset_line_sources();
+  vga_swap_buffers(true);
+  check_frame("reset, scrolled buffer", b, 100, 300, -1, NULL);
+
+  vga_reset_line_sources();
+  vga_swap_buffers(true);
+  check_frame("reset, line source", a, 100, 300, -1, NULL);
+
+  printf("virtual canvas %dx%d: %s\n", CANVAS_WIDTH, CANVAS_HEIGHT, errors ? "FAILED" : "OK");
+  return errors != 0;
+}
@@ -0,0 +1,187 @@
+/**
+ * chain_sim.c
+ *
+ * Runs the VGA driver in framebuffer mode on the host and checks that
+ * the byte stream the DMA chain sends to the PIO is identical to the
+ * plain layout of one hblank block and one pixel block per line
+ * (front porch, vsync, back porch, then visible lines).  Also reports
+ * the number of control blocks loaded per frame, checks that a line
+ * set with vga_set_line_source() is sent from its source, and checks
+ * that the scanout statistics count repeated frames and PIO stalls.
+ *
+ * With VGA_ENABLE_PIO_SYNC the PIO generates the blanking, so the
+ * expected stream has only the visible pixels.
+ *
+ * Usage: chain_sim [240|200] [num_frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "host_sdk.h"
+#include "stream.h"
+
+static const struct VGA_MODE *mode = &vga_mode_320x240;
+
+static int source_line = -1;            // screen line read from source_data
+static unsigned int source_data[1024 / 4];
+
+static unsigned char pattern(int x, int y)
+{
+  return (x + 3*y) & 0x3f;
+}
+
+static unsigned char source_pattern(int x)
+{
+  return (63 - x) & 0x3f;
+}
+
+// pattern expected on the screen
+static unsigned char screen_pattern(int x, int y)
+{
+  return (y == source_line) ? source_pattern(x) : pattern(x, y);
+}
+
+// write one frame in the plain layout to out, return the number of bytes written
+static size_t make_frame(uint8_t *out)
+{
+  uint8_t *p = out;
+
+#if ! VGA_ENABLE_PIO_SYNC
+  int h_blank = mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch;
+  int v_blank = mode->v_front_porch + mode->v_sync_pulse + mode->v_back_porch;
+  uint8_t hsync_on = (!mode->h_polarity) << 6;
+  uint8_t vsync_on = (!mode->v_polarity) << 7;
+  uint8_t sync_off = vga_screen.sync_bits;
+
+  for (int line = 0; line < v_blank + mode->v_pixels; line++) {
+    bool vsync = (line >= mode->v_front_porch && line < mode->v_front_porch + mode->v_sync_pulse);
+    uint8_t v = vsync ? vsync_on : (sync_off & 0x80);
+
+    // hblank
+    for (int x = 0; x < h_blank; x++) {
+      bool hsync = (x >= mode->h_front_porch && x < mode->h_front_porch + mode->h_sync_pulse);
+      *p++ = v | (hsync ? hsync_on : (sync_off & 0x40));
+    }
+
+    // pixels
+    for (int x = 0; x < mode->h_pixels; x++) {
+      if (line < v_blank) {
+        *p++ = v | (sync_off & 0x40);
+      } else {
+        *p++ = sync_off | screen_pattern(x, (line - v_blank) / mode->v_div);
+      }
+    }
+  }
+#else
+  for (int line = 0; line < mode->v_pixels; line++) {
+    for (int x = 0; x < mode->h_pixels; x++) {
+      *p++ = screen_pattern(x, line / mode->v_div);
+    }
+  }
+#endif
+
+  return p - out;
+}
+
+// check num_frames frames of the stream against the plain layout
+static int check_stream(const uint8_t *frame, size_t frame_len, int num_frames)
+{
+  for (int f = 0; f < num_frames; f++) {
+    const uint8_t *got = &stream[f * frame_len];
+    for (size_t i = 0; i < frame_len; i++) {
+      if (got[i] != frame[i]) {
+        printf("frame %d, byte %zu: got 0x%02x, expected 0x%02x\n", f, i, got[i], frame[i]);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+static void draw_pattern(void)
+{
+  for (int y = 0; y < vga_screen.height; y++) {
+    unsigned char *line = (unsigned char *) vga_screen.framebuffer[y];
+    for (int x = 0; x < vga_screen.width; x++) {
+      line[x] = vga_screen.sync_bits | pattern(x, y);
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1 && strcmp(argv[1], "200") == 0) mode = &vga_mode_320x200;
+  int num_frames = (argc > 2) ? atoi(argv[2]) : 3;
+
+  stream_capture_dma();
+  if (vga_init(mode, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+
+  // draw the pattern in both framebuffers; the last swap returns at
+  // the end of a frame's visible area, so the stream then starts with
+  // the next frame's front porch
+  for (int i = 0; i < 2; i++) {
+    draw_pattern();
+    vga_swap_buffers(true);
+  }
+  stream_len = 0;
+  uint64_t start_reg_writes = host_dma_reg_writes();
+
+  size_t frame_cap = (size_t) 4 * (mode->v_front_porch + mode->v_sync_pulse + mode->v_back_porch + mode->v_pixels) *
+    (mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch + mode->h_pixels);
+  uint8_t *frame = malloc(frame_cap);
+  if (! frame) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  size_t frame_len = make_frame(frame);
+
+  if (stream_run_dma(num_frames * frame_len) != 0) return 1;
+  uint64_t reg_writes = host_dma_reg_writes() - start_reg_writes;
+  int ret = check_stream(frame, frame_len, num_frames);
+
+  // each block loaded by the control channel writes 4 registers
+  printf("%dx%d: %d frames %s, %.1f control blocks per frame\n",
+         vga_screen.width, vga_screen.height, num_frames, ret ? "FAILED" : "OK",
+         (double) reg_writes / 4 / num_frames);
+
+  // read a line of the next frame from elsewhere; it's shown after
+  // the swap, so the stream again starts with the front porch
+  source_line = vga_screen.height / 3;
+  for (int x = 0; x < mode->h_pixels; x++) {
+    ((unsigned char *) source_data)[x] = vga_screen.sync_bits | source_pattern(x);
+  }
+  draw_pattern();
+  vga_set_line_source(source_line, source_data);
+  vga_swap_buffers(true);
+  stream_len = 0;
+  make_frame(frame);
+  if (stream_run_dma(frame_len) != 0) return 1;
+  bool source_ok = (check_stream(frame, frame_len, 1) == 0);
+  printf("line source: %s\n", source_ok ? "OK" : "FAILED");
+  if (! source_ok) ret = 1;
+
+  // no frames were submitted while streaming, so all were repeated;
+  // then a stall of the state machine must count as one underrun
+  struct VGA_STATS stats;
+  vga_get_stats(&stats);
+  bool stats_ok = (stats.repeated_frames >= num_frames && stats.underrun_frames == 0 && ! stats.dma_error);
+  host_pio_set_tx_stall(pio0, stream_sm);
+  vga_reset_stats();
+  vga_get_stats(&stats);
+  while (stats.frames < 2) {
+    if (! host_dma_step()) break;
+    vga_get_stats(&stats);
+  }
+  if (stats.underrun_frames != 1 || stats.repeated_frames != 2) stats_ok = false;
+  printf("stats: %s\n", stats_ok ? "OK" : "FAILED");
+  if (! stats_ok) ret = 1;
+
+  free(frame);
+  return ret;
+}
@@ -0,0 +1,119 @@
+/**
+ * clear_sim.c
+ *
+ * Runs the VGA driver on the host with DMA transfers to memory taking
+ * time (a chunk of words for each emulated scanout transfer), and
+ * checks the background clear: vga_clear_screen_async() must return
+ * before the framebuffer is cleared, vga_clear_wait_lines(n) must
+ * return as soon as (and not before) the first n lines are cleared,
+ * and vga_set_auto_clear() must clear each new buffer returned by
+ * vga_swap_buffers() until it's disabled.
+ *
+ * Usage: clear_sim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "host_sdk.h"
+
+#define CHUNK_WORDS   50        // less than a line, so lines are cleared in parts
+#define DRAWN_COLOR   0x15
+#define CLEAR_COLOR   0x2a
+#define AUTO_COLOR    0x0f
+
+static int errors;
+
+static void draw(unsigned char color)
+{
+  for (int y = 0; y < vga_screen.height; y++) {
+    memset(vga_screen.framebuffer[y], vga_screen.sync_bits | color, vga_screen.width);
+  }
+}
+
+// Returns the number of lines from the top that have the color
+static int count_lines(unsigned char color)
+{
+  unsigned char pix = vga_screen.sync_bits | color;
+  for (int y = 0; y < vga_screen.height; y++) {
+    const unsigned char *line = (const unsigned char *) vga_screen.framebuffer[y];
+    for (int x = 0; x < vga_screen.width; x++) {
+      if (line[x] != pix) return y;
+    }
+  }
+  return vga_screen.height;
+}
+
+static void check(const char *what, int got, int expected)
+{
+  if (got != expected) {
+    printf("%s: got %d, expected %d\n", what, got, expected);
+    errors++;
+  }
+}
+
+static void check_clear_wait(void)
+{
+  // the clear doesn't progress until the DMA runs
+  draw(DRAWN_COLOR);
+  vga_clear_screen_async(CLEAR_COLOR);
+  check("cleared lines after the async clear started", count_lines(CLEAR_COLOR), 0);
+
+  // each wait returns within the chunk that clears its last line
+  int line_words = vga_screen.width / 4;
+  static const int wait_lines[] = { 1, 17, 100 };
+  for (int i = 0; i < (int) count_of(wait_lines); i++) {
+    int n = wait_lines[i];
+    vga_clear_wait_lines(n);
+    int expected = (n * line_words + CHUNK_WORDS - 1) / CHUNK_WORDS * CHUNK_WORDS / line_words;
+    char what[64];
+    snprintf(what, sizeof(what), "cleared lines after waiting for %d", n);
+    check(what, count_lines(CLEAR_COLOR), expected);
+  }
+
+  vga_clear_wait();
+  check("cleared lines after waiting for all", count_lines(CLEAR_COLOR), vga_screen.height);
+}
+
+static void check_auto_clear(void)
+{
+  // both buffers drawn, auto clear off
+  for (int i = 0; i < 2; i++) {
+    draw(DRAWN_COLOR);
+    vga_swap_buffers(true);
+  }
+  check("drawn lines with auto clear off", count_lines(DRAWN_COLOR), vga_screen.height);
+
+  vga_set_auto_clear(AUTO_COLOR);
+  for (int i = 0; i < 2; i++) {
+    draw(DRAWN_COLOR);
+    vga_swap_buffers(true);
+    check("auto cleared lines after the swap", count_lines(AUTO_COLOR), 0);
+    vga_clear_wait();
+    check("auto cleared lines after waiting", count_lines(AUTO_COLOR), vga_screen.height);
+  }
+
+  vga_set_auto_clear(-1);
+  draw(DRAWN_COLOR);
+  vga_swap_buffers(true);
+  draw(DRAWN_COLOR);
+  vga_swap_buffers(true);
+  check("drawn lines with auto clear disabled", count_lines(DRAWN_COLOR), vga_screen.height);
+}
+
+int main(void)
+{
+  if (vga_init(&vga_mode_320x240, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  host_dma_set_memory_chunk(CHUNK_WORDS);
+
+  check_clear_wait();
+  check_auto_clear();
+
+  printf("background clear: %s\n", errors ? "FAILED" : "OK");
+  return errors != 0;
+}
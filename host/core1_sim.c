@@ -0,0 +1,172 @@
+/**
+ * core1_sim.c
+ *
+ * Runs the core1 job queue with core1 as a second thread: each frame
+ * the top half of the framebuffer is filled by jobs on core1 (one job
+ * per band of lines) while core0 fills the bottom half, then the frame
+ * is checked after the fence in vga_swap_buffers().  Then it checks
+ * that a draw list drawn split across both cores gives the same image
+ * as drawing directly on core0.
+ *
+ * Usage: core1_sim [num_frames] [lines_per_job]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "vga_draw.h"
+#include "vga_font.h"
+#include "host_sdk.h"
+
+#define SPRITE_W 37
+#define SPRITE_H 29
+#define SPRITE_STRIDE ((SPRITE_W + 3) / 4)
+
+static unsigned int sprite_data[SPRITE_STRIDE * SPRITE_H];
+static unsigned char font_data[96 * 8];
+static const struct VGA_FONT test_font = { 6, 8, 32, 96, font_data };
+
+struct BAND {
+  int y;
+  int height;
+  unsigned char color;
+};
+
+static void fill_lines(int y, int height, unsigned char color)
+{
+  for (int i = y; i < y + height; i++) {
+    memset(vga_screen.framebuffer[i], vga_screen.sync_bits | color, vga_screen.width);
+  }
+}
+
+static void fill_band(void *data)
+{
+  struct BAND *band = data;
+  fill_lines(band->y, band->height, band->color);
+}
+
+static void draw_scene(struct SPRITE *spr, int frame)
+{
+  draw_clear(frame & 0x3f);
+  for (int i = 0; i < 40; i++) {
+    int x = (i * 53 + frame * 7) % (vga_screen.width + SPRITE_W) - SPRITE_W;
+    int y = (i * 31 + frame * 3) % (vga_screen.height + SPRITE_H) - SPRITE_H;
+    draw_sprite(spr, x, y, i & 1);
+  }
+  font_set_border(frame & 1, 0x05);
+  for (int i = 0; i < 8; i++) {
+    font_move((i * 41 + frame) % vga_screen.width - 20, vga_screen.height/2 - 12 + i*3);
+    font_printf("draw list %d", i);
+  }
+}
+
+static int check_draw_list(int num_frames)
+{
+  // random image with some transparent (0x0c) pixels
+  unsigned int seed = 1;
+  for (int i = 0; i < count_of(sprite_data); i++) {
+    unsigned int word = 0;
+    for (int b = 0; b < 4; b++) {
+      seed = seed * 1103515245 + 12345;
+      unsigned int pix = (seed >> 16) & 0x3f;
+      if ((seed >> 24) % 4 == 0) pix = 0x0c;
+      word |= (vga_screen.sync_bits | pix) << (8*b);
+    }
+    sprite_data[i] = word;
+  }
+  for (int i = 0; i < count_of(font_data); i++) {
+    seed = seed * 1103515245 + 12345;
+    font_data[i] = seed >> 16;
+  }
+  struct SPRITE spr = { SPRITE_W, SPRITE_H, SPRITE_STRIDE, sprite_data };
+  font_set_font(&test_font);
+  font_set_color(0x3f);
+
+  size_t line_len = vga_screen.width;
+  unsigned char *expected = malloc(line_len * vga_screen.height);
+  if (! expected) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  int bad_frames = 0;
+  for (int frame = 0; frame < num_frames; frame++) {
+    unsigned int **fb = vga_screen.framebuffer;
+    draw_scene(&spr, frame);
+    for (int y = 0; y < vga_screen.height; y++) {
+      memcpy(expected + y*line_len, fb[y], line_len);
+      memset(fb[y], vga_screen.sync_bits | ((frame + 32) & 0x3f), line_len);
+    }
+
+    draw_list_begin(true);
+    draw_scene(&spr, frame);
+    draw_list_end();
+
+    for (int y = 0; y < vga_screen.height; y++) {
+      if (memcmp(expected + y*line_len, fb[y], line_len) != 0) {
+        if (bad_frames++ < 10) printf("draw list frame %d: line %d differs\n", frame, y);
+        break;
+      }
+    }
+    vga_swap_buffers(false);
+  }
+
+  printf("%d frames drawn split across cores: %s\n", num_frames, bad_frames ? "FAILED" : "OK");
+  free(expected);
+  return bad_frames;
+}
+
+int main(int argc, char *argv[])
+{
+  int num_frames    = (argc > 1) ? atoi(argv[1]) : 100;
+  int lines_per_job = (argc > 2) ? atoi(argv[2]) : 8;
+
+  if (vga_init(&vga_mode_320x240, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+
+  int half = vga_screen.height / 2;
+  int num_bands = (half + lines_per_job - 1) / lines_per_job;
+  struct BAND *bands = malloc(num_bands * sizeof(struct BAND));
+  if (! bands) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  int bad_frames = 0;
+  for (int frame = 0; frame < num_frames; frame++) {
+    unsigned char color = frame & 0x3f;
+    unsigned int **fb = vga_screen.framebuffer;
+
+    for (int i = 0; i < num_bands; i++) {
+      bands[i].y = i * lines_per_job;
+      bands[i].height = (bands[i].y + lines_per_job > half) ? half - bands[i].y : lines_per_job;
+      bands[i].color = color;
+      vga_core1_submit(fill_band, &bands[i]);
+    }
+    fill_lines(half, vga_screen.height - half, color);
+    vga_swap_buffers(false);
+
+    // the fence in vga_swap_buffers() ensures all jobs are done
+    for (int y = 0; y < vga_screen.height; y++) {
+      const unsigned char *line = (const unsigned char *) fb[y];
+      bool ok = true;
+      for (int x = 0; x < vga_screen.width; x++) {
+        if (line[x] != (vga_screen.sync_bits | color)) ok = false;
+      }
+      if (! ok) {
+        if (bad_frames++ < 10) printf("frame %d: line %d not filled\n", frame, y);
+        break;
+      }
+    }
+  }
+
+  printf("%d frames, %d jobs per frame: %s\n", num_frames, num_bands, bad_frames ? "FAILED" : "OK");
+  free(bands);
+
+  bad_frames += check_draw_list(num_frames);
+  return bad_frames != 0;
+}
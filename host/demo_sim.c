@@ -0,0 +1,209 @@
+/**
+ * demo_sim.c
+ *
+ * Runs the demo's frame composition (demo.c) on the host with a seeded
+ * random number generator and a fixed fps count, so every run draws
+ * exactly the same frames.  Each frame is read from the framebuffer
+ * just before it's swapped, and can be written as a PPM image, compared
+ * with a PPM image of a known good build, and checked against a list of
+ * checksums.  Only the 6 color bits are used, so images and checksums
+ * are the same with and without VGA_ENABLE_PIO_SYNC.  With
+ * VGA_ENABLE_PROFILER the frames have the profiler overlay and the
+ * frame times are printed as CSV.
+ *
+ * Usage: demo_sim [-o out_dir] [-g golden_dir] [-c checksum_file [-w]] [num_frames]
+ *
+ *   -o  write frame N to out_dir/frame_NNNN.ppm
+ *   -g  compare frame N with golden_dir/frame_NNNN.ppm (if it exists)
+ *   -c  compare the checksum of each frame with the file
+ *   -w  write the checksums to the file instead of comparing them
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "vga_6bit.h"
+#include "vga_prof.h"
+#include "demo.h"
+#include "host_sdk.h"
+
+#define DEMO_FPS  60
+#define DEMO_SEED 1
+
+static unsigned int seed = DEMO_SEED;
+
+static unsigned int demo_rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) & 0x7fff;
+}
+
+// Convert the framebuffer being drawn to RGB (2 bits per component:
+// red in bits 0-1, green in 2-3, blue in 4-5)
+static void read_frame(unsigned char *rgb)
+{
+  for (int y = 0; y < vga_screen.height; y++) {
+    const unsigned char *line = (const unsigned char *) vga_screen.framebuffer[y];
+    for (int x = 0; x < vga_screen.width; x++) {
+      unsigned char pix = line[x];
+      *rgb++ = ((pix >> 0) & 3) * 85;
+      *rgb++ = ((pix >> 2) & 3) * 85;
+      *rgb++ = ((pix >> 4) & 3) * 85;
+    }
+  }
+}
+
+// FNV-1a
+static uint32_t checksum(const unsigned char *data, size_t len)
+{
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    hash = (hash ^ data[i]) * 16777619u;
+  }
+  return hash;
+}
+
+static int write_ppm(const char *filename, const unsigned char *rgb)
+{
+  FILE *f = fopen(filename, "wb");
+  if (! f) {
+    printf("can't write %s\n", filename);
+    return 1;
+  }
+  fprintf(f, "P6\n%d %d\n255\n", vga_screen.width, vga_screen.height);
+  fwrite(rgb, 3, vga_screen.width * vga_screen.height, f);
+  fclose(f);
+  return 0;
+}
+
+// Returns the number of different pixels, 0 if there's no golden image
+static int compare_ppm(const char *filename, const unsigned char *rgb)
+{
+  FILE *f = fopen(filename, "rb");
+  if (! f) return 0;
+
+  int w, h, max;
+  int num_pixels = vga_screen.width * vga_screen.height;
+  if (fscanf(f, "P6 %d %d %d", &w, &h, &max) != 3 || w != vga_screen.width || h != vga_screen.height) {
+    printf("%s: not a %dx%d PPM image\n", filename, vga_screen.width, vga_screen.height);
+    fclose(f);
+    return num_pixels;
+  }
+  fgetc(f);
+
+  int diff = 0;
+  for (int i = 0; i < num_pixels; i++) {
+    unsigned char golden[3];
+    if (fread(golden, 3, 1, f) != 1) {
+      diff += num_pixels - i;
+      break;
+    }
+    if (memcmp(golden, &rgb[3*i], 3) != 0) diff++;
+  }
+  fclose(f);
+  return diff;
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr, "USAGE: %s [-o out_dir] [-g golden_dir] [-c checksum_file [-w]] [num_frames]\n", prog);
+  exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *out_dir = NULL;
+  const char *golden_dir = NULL;
+  const char *checksum_file = NULL;
+  bool write_checksums = false;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "o:g:c:w")) != -1) {
+    switch (opt) {
+    case 'o': out_dir = optarg; break;
+    case 'g': golden_dir = optarg; break;
+    case 'c': checksum_file = optarg; break;
+    case 'w': write_checksums = true; break;
+    default: usage(argv[0]);
+    }
+  }
+  if (write_checksums && ! checksum_file) usage(argv[0]);
+  int num_frames = (optind < argc) ? atoi(argv[optind]) : 120;
+
+  FILE *checksums = NULL;
+  if (checksum_file) {
+    checksums = fopen(checksum_file, (write_checksums) ? "w" : "r");
+    if (! checksums) {
+      printf("can't open %s\n", checksum_file);
+      return 1;
+    }
+  }
+
+  if (vga_init(&vga_mode_320x240, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  demo_init(demo_rand);
+
+  size_t rgb_len = (size_t) 3 * vga_screen.width * vga_screen.height;
+  unsigned char *rgb = malloc(rgb_len);
+  if (! rgb) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  int bad_frames = 0;
+  for (int frame = 0; frame < num_frames; frame++) {
+    prof_frame_start();
+#if VGA_ENABLE_PROFILER
+    prof_print_csv();
+#endif
+    demo_frame(DEMO_FPS);
+#if VGA_ENABLE_MULTICORE
+    vga_core1_fence();
+#endif
+    read_frame(rgb);
+    uint32_t sum = checksum(rgb, rgb_len);
+    bool bad = false;
+
+    char filename[1024];
+    if (out_dir) {
+      snprintf(filename, sizeof(filename), "%s/frame_%04d.ppm", out_dir, frame);
+      if (write_ppm(filename, rgb) != 0) bad = true;
+    }
+    if (golden_dir) {
+      snprintf(filename, sizeof(filename), "%s/frame_%04d.ppm", golden_dir, frame);
+      int diff = compare_ppm(filename, rgb);
+      if (diff != 0) {
+        printf("frame %d: %d pixels differ from %s\n", frame, diff, filename);
+        bad = true;
+      }
+    }
+    if (checksums && write_checksums) {
+      fprintf(checksums, "%d %08x\n", frame, sum);
+    } else if (checksums) {
+      int golden_frame;
+      unsigned int golden_sum;
+      if (fscanf(checksums, "%d %x", &golden_frame, &golden_sum) != 2 || golden_frame != frame) {
+        printf("frame %d: no checksum in %s\n", frame, checksum_file);
+        bad = true;
+      } else if (golden_sum != sum) {
+        printf("frame %d: checksum %08x, expected %08x\n", frame, sum, golden_sum);
+        bad = true;
+      }
+    }
+    if (bad) bad_frames++;
+
+    int scope = prof_begin("swap wait");
+    vga_swap_buffers(true);
+    prof_end(scope);
+  }
+
+  printf("%d frames drawn: %s\n", num_frames, bad_frames ? "FAILED" : "OK");
+  if (checksums) fclose(checksums);
+  free(rgb);
+  return bad_frames != 0;
+}
@@ -0,0 +1,121 @@
+/**
+ * draw_bench.c
+ *
+ * Times drawing the demo's character frames with transparency at each
+ * of the 4 pixel alignments, using the plain blitters
+ * (draw_image_line_tr*), pre-shifted copies and spans, and mirrored
+ * with DRAW_FLIP_H, and the time to draw the demo's background with
+ * draw_sprite() for each tile and with draw_tilemap().  Also reports
+ * the memory taken by pre-shifted copies and spans.  Times are for the
+ * host CPU, so only the ratios mean something for the RP2040.
+ *
+ * Usage: draw_bench [draws_per_test]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pico/stdlib.h"
+
+#include "vga_6bit.h"
+#include "vga_draw.h"
+#include "host_sdk.h"
+
+#include "data/loserboy.h"
+#include "data/tiles.h"
+
+#define NUM_FRAMES img_loserboy_num_spr
+
+static const unsigned char bg_map[20] = {
+  0,0,0,0,0,
+  0,0,1,0,0,
+  0,1,0,1,0,
+  0,0,0,0,0,
+};
+
+static struct SPRITE plain[NUM_FRAMES];
+static struct SPRITE preshifted[NUM_FRAMES];
+static struct SPRITE spans[NUM_FRAMES];
+
+// Return the time in ns per sprite to draw n sprites at x = 4*k + align
+static double time_draws(struct SPRITE *sprites, int align, int n, unsigned int flags)
+{
+  uint64_t start = time_us_64();
+  for (int i = 0; i < n; i++) {
+    int x = 4*(i % 60) + align;
+    int y = (i * 7) % (vga_screen.height - img_loserboy_height);
+    draw_sprite(&sprites[i % NUM_FRAMES], x, y, flags);
+  }
+  return (time_us_64() - start) * 1000.0 / n;
+}
+
+// Return the time in us per background drawn with sprites or a tilemap
+static double time_background(bool tilemap, int n)
+{
+  struct SPRITE tiles[img_tiles_num_spr] = { 0 };
+  for (int i = 0; i < img_tiles_num_spr; i++) {
+    tiles[i].width  = img_tiles_width;
+    tiles[i].height = img_tiles_height;
+    tiles[i].stride = img_tiles_stride;
+    tiles[i].data   = &img_tiles_data[i*img_tiles_stride*img_tiles_height];
+  }
+  struct TILEMAP tm = { 5, 4, bg_map, img_tiles_data };
+
+  uint64_t start = time_us_64();
+  for (int i = 0; i < n; i++) {
+    if (tilemap) {
+      draw_tilemap(&tm, 0, 0);
+    } else {
+      for (int t = 0; t < 20; t++) {
+        draw_sprite(&tiles[bg_map[t]], (t%5)*img_tiles_width, (t/5)*img_tiles_height, 0);
+      }
+    }
+  }
+  return (double) (time_us_64() - start) / n;
+}
+
+int main(int argc, char *argv[])
+{
+  int n = (argc > 1) ? atoi(argv[1]) : 200000;
+
+  if (vga_init(&vga_mode_320x240, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+
+  unsigned int preshift_bytes = 0;
+  unsigned int span_bytes = 0;
+  unsigned int image_bytes = 0;
+  for (int i = 0; i < NUM_FRAMES; i++) {
+    struct SPRITE *spr = &plain[i];
+    spr->width  = img_loserboy_width;
+    spr->height = img_loserboy_height;
+    spr->stride = img_loserboy_stride;
+    spr->data   = &img_loserboy_data[i*img_loserboy_stride*img_loserboy_height];
+    preshifted[i] = *spr;
+    spans[i] = *spr;
+    if (! draw_preshift_sprite(&preshifted[i], ~0u) || ! draw_encode_spans(&spans[i], ~0u)) {
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+    image_bytes    += spr->stride * spr->height * sizeof(unsigned int);
+    preshift_bytes += draw_preshift_size(spr);
+    span_bytes     += draw_spans_size(spr);
+  }
+
+  printf("%d frames of %dx%d: images %u bytes, pre-shifted copies %u bytes, spans %u bytes\n",
+         NUM_FRAMES, img_loserboy_width, img_loserboy_height, image_bytes, preshift_bytes, span_bytes);
+  printf("ns per transparent sprite:\n");
+  printf("x%%4   plain  preshift  spans  flipped\n");
+  for (int align = 0; align < 4; align++) {
+    double t_plain    = time_draws(plain, align, n, DRAW_TRANSPARENT);
+    double t_preshift = time_draws(preshifted, align, n, DRAW_TRANSPARENT);
+    double t_spans    = time_draws(spans, align, n, DRAW_TRANSPARENT);
+    double t_flipped  = time_draws(plain, align, n, DRAW_TRANSPARENT | DRAW_FLIP_H);
+    printf("%4d %7.0f %9.0f %6.0f %8.0f\n", align, t_plain, t_preshift, t_spans, t_flipped);
+  }
+
+  printf("us per background: %.1f with draw_sprite(), %.1f with draw_tilemap()\n",
+         time_background(false, n/100), time_background(true, n/100));
+  return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * font_sim.c
+ *
+ * Draws text with fonts converted by fontconv from host/fonts/test.bdf
+ * (a proportional and a fixed width font with glyphs wider than 8
+ * pixels, and a proportional font with narrow glyphs) and checks every
+ * pixel of the framebuffer against a reference that draws each glyph
+ * a pixel at a time, with and without a border, at every alignment
+ * and clipped at the left and right edges of the screen.  The border
+ * reference draws the 8 neighbors of every glyph pixel first, then
+ * the glyphs.
+ *
+ * Usage: font_sim
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "vga_6bit.h"
+#include "vga_font.h"
+#include "host_sdk.h"
+
+#include "font_test_wide.h"
+#include "font_test_fixed.h"
+#include "font_test_narrow.h"
+
+#define BG_COLOR      0x01
+#define TEXT_COLOR    0x3c
+#define BORDER_COLOR  0x13
+
+struct TEST_FONT {
+  const char *name;
+  const struct VGA_FONT *font;
+};
+
+static const struct TEST_FONT test_fonts[] = {
+  { "wide, proportional", &font_test_wide },
+  { "wide, fixed width",  &font_test_fixed },
+  { "narrow, proportional", &font_test_narrow },
+};
+
+// every glyph, with a character that's not in the fonts in the middle
+static const char test_text[] = "ABCD EFGDCBA";
+
+static unsigned char *ref;
+
+static void ref_set(int x, int y, unsigned char color)
+{
+  if (x < 0 || x >= vga_screen.width || y < 0 || y >= vga_screen.height) return;
+  ref[y * vga_screen.width + x] = vga_screen.sync_bits | color;
+}
+
+// Draws the glyph pixels (pass 0) or their borders (pass 1) of the text
+static void ref_text(const struct VGA_FONT *font, int x, int y, int pass)
+{
+  for (const char *p = test_text; *p != '\0'; p++) {
+    int ch = (unsigned char) *p;
+    if (ch < font->first_char || ch >= font->first_char + font->num_chars) {
+      x += font->w;
+      continue;
+    }
+    int index = ch - font->first_char;
+    int advance = (font->advance) ? font->advance[index] : font->w;
+    for (int r = 0; r < font->h; r++) {
+      unsigned int row = (font->data) ? font->data[font->h*index + r] : font->wide_data[font->h*index + r];
+      for (int i = 0; i < advance; i++) {
+        if (! ((row >> i) & 1)) continue;
+        if (pass == 0) {
+          ref_set(x + i, y + r, TEXT_COLOR);
+          continue;
+        }
+        for (int dy = -1; dy <= 1; dy++) {
+          for (int dx = -1; dx <= 1; dx++) {
+            ref_set(x + i + dx, y + r + dy, BORDER_COLOR);
+          }
+        }
+      }
+    }
+    x += advance;
+  }
+}
+
+static int check_text(const struct TEST_FONT *t, int x, int y, bool border)
+{
+  memset(ref, vga_screen.sync_bits | BG_COLOR, vga_screen.width * vga_screen.height);
+  if (border) ref_text(t->font, x, y, 1);
+  ref_text(t->font, x, y, 0);
+
+  vga_clear_screen(BG_COLOR);
+  font_draw_text(t->font, x, y, test_text, vga_screen.sync_bits | TEXT_COLOR,
+                 border, vga_screen.sync_bits | BORDER_COLOR);
+
+  for (int py = 0; py < vga_screen.height; py++) {
+    const unsigned char *line = (const unsigned char *) vga_screen.framebuffer[py];
+    for (int px = 0; px < vga_screen.width; px++) {
+      unsigned char expected = ref[py * vga_screen.width + px];
+      if (line[px] != expected) {
+        printf("%s font, %s border, text at (%d, %d): pixel (%d, %d) is 0x%02x, expected 0x%02x\n",
+               t->name, border ? "with" : "no", x, y, px, py, line[px], expected);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int main(void)
+{
+  if (vga_init(&vga_mode_320x240, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  ref = malloc(vga_screen.width * vga_screen.height);
+  if (! ref) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  int errors = 0;
+  for (int f = 0; f < (int) count_of(test_fonts); f++) {
+    const struct TEST_FONT *t = &test_fonts[f];
+    int width = font_text_width(t->font, test_text);
+    int xs[] = { 1, 2, 3, 4, -7, vga_screen.width - width/2 };
+    for (int border = 0; border <= 1; border++) {
+      for (int i = 0; i < (int) count_of(xs); i++) {
+        errors += check_text(t, xs[i], 20 + 3*i, border);
+      }
+    }
+    printf("%s font, %d pixels wide: %s\n", t->name, t->font->w, errors ? "FAILED" : "OK");
+  }
+
+  free(ref);
+  return errors != 0;
+}
@@ -0,0 +1,251 @@
+/**
+ * fontconv.c
+ *
+ * Converts a BDF font or a PNG strip of glyphs to a header with a
+ * struct VGA_FONT (like data/font6x8.h).  Rows are written with bit i
+ * set for pixel i and masked to the glyph's advance, which is the
+ * layout vga_font.c draws a framebuffer word at a time.  Glyphs up to
+ * 8 pixels wide get a byte per row in NAME_data, wider glyphs (up to
+ * 16) a 16-bit word per row in NAME_wide_data.
+ *
+ * In a PNG strip, glyph i is the cell of char_w columns starting at
+ * column i*char_w, and pixels brighter than 50% (and more than 50%
+ * opaque) are set.  The font height is the image height.
+ *
+ * With -p, each glyph advances by its own width (DWIDTH in BDF files,
+ * the last set column plus one pixel of spacing in PNG strips) and an
+ * advance table is written.
+ *
+ * Usage: fontconv [-p] NAME font.bdf [first_char num_chars]
+ *        fontconv [-p] NAME strip.png char_w [first_char]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#if FONTCONV_PNG
+#include <png.h>
+#endif
+
+#define MAX_W     16
+#define MAX_H     32
+#define MAX_CHARS 256
+
+struct GLYPH {
+  bool present;
+  int advance;
+  unsigned int rows[MAX_H];
+};
+
+static struct GLYPH glyphs[MAX_CHARS];
+static int font_w, font_h;
+static int first_char = 32;
+static int num_chars = 96;
+static bool proportional;
+
+static void die(const char *msg, const char *arg)
+{
+  fprintf(stderr, "fontconv: %s%s%s\n", msg, (arg) ? ": " : "", (arg) ? arg : "");
+  exit(1);
+}
+
+static bool has_suffix(const char *str, const char *suffix)
+{
+  size_t len = strlen(str), suffix_len = strlen(suffix);
+  return len >= suffix_len && strcmp(str + len - suffix_len, suffix) == 0;
+}
+
+// === BDF ==========================================================
+
+static void read_bdf(const char *filename)
+{
+  FILE *f = fopen(filename, "r");
+  if (! f) die("can't open", filename);
+
+  char line[256];
+  int ascent = -1, box_h = 0, box_y = 0;
+  int ch = -1, dwidth = 0, bbx_w = 0, bbx_h = 0, bbx_x = 0, bbx_y = 0;
+  int bitmap_row = -1;
+  while (fgets(line, sizeof(line), f)) {
+    if (bitmap_row >= 0) {
+      if (strncmp(line, "ENDCHAR", 7) == 0) {
+        bitmap_row = -1;
+        continue;
+      }
+      if (ch < 0 || ch >= MAX_CHARS) continue;
+      // bits are MSB first, padded to whole bytes
+      unsigned long bits = strtoul(line, NULL, 16);
+      int nbits = 4 * (int) strspn(line, "0123456789abcdefABCDEF");
+      int y = ascent - (bbx_y + bbx_h) + bitmap_row++;
+      if (y < 0 || y >= font_h) continue;
+      for (int i = 0; i < bbx_w && i < nbits; i++) {
+        int x = bbx_x + i;
+        if (x < 0 || x >= MAX_W) continue;
+        if (bits & (1ul << (nbits - 1 - i))) glyphs[ch].rows[y] |= 1u << x;
+      }
+      continue;
+    }
+
+    if (sscanf(line, "FONTBOUNDINGBOX %*d %d %*d %d", &box_h, &box_y) == 2) {
+      font_h = box_h;
+      if (ascent < 0) ascent = box_h + box_y;
+    } else if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1) {
+      /* got it */
+    } else if (sscanf(line, "ENCODING %d", &ch) == 1) {
+      dwidth = 0;
+    } else if (sscanf(line, "DWIDTH %d", &dwidth) == 1) {
+      /* got it */
+    } else if (sscanf(line, "BBX %d %d %d %d", &bbx_w, &bbx_h, &bbx_x, &bbx_y) == 4) {
+      /* got it */
+    } else if (strncmp(line, "BITMAP", 6) == 0) {
+      bitmap_row = 0;
+      if (ch >= 0 && ch < MAX_CHARS) {
+        // glyphs not converted don't make the font wider
+        int w = (bbx_x + bbx_w > dwidth) ? bbx_x + bbx_w : dwidth;
+        if (ch >= first_char && ch < first_char + num_chars && w > font_w) font_w = w;
+        glyphs[ch].present = true;
+        glyphs[ch].advance = dwidth;
+      }
+    }
+  }
+  fclose(f);
+
+  if (font_h < 1 || font_h > MAX_H) die("unsupported font height", filename);
+  if (font_w < 1 || font_w > MAX_W) die("unsupported font width", filename);
+  // glyphs with no advance (e.g. combining marks) still take 1 pixel
+  for (int c = 0; c < MAX_CHARS; c++) {
+    if (glyphs[c].present && glyphs[c].advance < 1) glyphs[c].advance = 1;
+  }
+}
+
+// === PNG ==========================================================
+
+#if FONTCONV_PNG
+static void read_png(const char *filename, int char_w)
+{
+  png_image image;
+  memset(&image, 0, sizeof(image));
+  image.version = PNG_IMAGE_VERSION;
+  if (! png_image_begin_read_from_file(&image, filename)) die("can't read", filename);
+  image.format = PNG_FORMAT_GA;
+  unsigned char *pixels = malloc(PNG_IMAGE_SIZE(image));
+  if (! pixels || ! png_image_finish_read(&image, NULL, pixels, 0, NULL)) die("can't read", filename);
+
+  font_w = char_w;
+  font_h = image.height;
+  if (font_h < 1 || font_h > MAX_H) die("unsupported font height", filename);
+  if (font_w < 1 || font_w > MAX_W) die("unsupported font width", filename);
+  num_chars = image.width / char_w;
+  if (first_char + num_chars > MAX_CHARS) num_chars = MAX_CHARS - first_char;
+
+  for (int c = 0; c < num_chars; c++) {
+    struct GLYPH *g = &glyphs[first_char + c];
+    int last_x = -1;
+    for (int y = 0; y < font_h; y++) {
+      for (int x = 0; x < char_w; x++) {
+        const unsigned char *p = &pixels[2 * (y*image.width + c*char_w + x)];
+        if (p[0] >= 128 && p[1] >= 128) {
+          g->rows[y] |= 1u << x;
+          if (x > last_x) last_x = x;
+        }
+      }
+    }
+    g->present = true;
+    // blank glyphs (space) advance by half a cell
+    g->advance = (last_x < 0) ? (char_w + 1) / 2 : last_x + 2;
+  }
+  free(pixels);
+  png_image_free(&image);
+}
+#endif
+
+// === OUTPUT =======================================================
+
+static void write_font(const char *name, const char *source)
+{
+  bool wide = font_w > 8;
+  int fixed_w = 0;
+
+  printf("/* File generated automatically from %s */\n\n", source);
+  printf("const %s %s_%sdata[] = {\n", (wide) ? "uint16_t" : "uint8_t", name, (wide) ? "wide_" : "");
+  for (int c = first_char; c < first_char + num_chars; c++) {
+    struct GLYPH *g = &glyphs[c];
+    int advance = (! g->present) ? font_w : (g->advance > font_w) ? font_w : g->advance;
+    if (! proportional) advance = font_w;
+    if (c == first_char) fixed_w = advance;
+    else if (advance != fixed_w) fixed_w = 0;
+    g->advance = advance;
+
+    printf(" ");
+    for (int y = 0; y < font_h; y++) {
+      unsigned int row = g->rows[y] & ((1u << advance) - 1);
+      printf((wide) ? " 0x%04x," : " 0x%02x,", row);
+    }
+    printf("\n");
+  }
+  printf("};\n");
+
+  // a proportional font where all glyphs have the same advance is fixed width
+  bool has_advance = proportional && fixed_w != font_w;
+  if (has_advance) {
+    printf("const uint8_t %s_advance[] = {\n", name);
+    for (int c = first_char; c < first_char + num_chars; c++) {
+      int i = c - first_char;
+      printf(" %2d,%s", glyphs[c].advance, (i % 16 == 15 || i == num_chars - 1) ? "\n" : "");
+    }
+    printf("};\n");
+  }
+
+  printf("const struct VGA_FONT %s = { %d, %d, %d, %d, ", name, font_w, font_h, first_char, num_chars);
+  if (wide && has_advance) {
+    printf("NULL, %s_advance, %s_wide_data };\n", name, name);
+  } else if (wide) {
+    printf("NULL, NULL, %s_wide_data };\n", name);
+  } else if (has_advance) {
+    printf("%s_data, %s_advance };\n", name, name);
+  } else {
+    printf("%s_data };\n", name);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  int arg = 1;
+  if (arg < argc && strcmp(argv[arg], "-p") == 0) {
+    proportional = true;
+    arg++;
+  }
+  if (argc - arg < 2) {
+    fprintf(stderr, "USAGE: %s [-p] NAME font.bdf [first_char num_chars]\n", argv[0]);
+    fprintf(stderr, "       %s [-p] NAME strip.png char_w [first_char]\n", argv[0]);
+    return 1;
+  }
+  const char *name = argv[arg];
+  const char *filename = argv[arg+1];
+
+  if (has_suffix(filename, ".png")) {
+#if FONTCONV_PNG
+    if (argc - arg < 3) die("missing char_w for", filename);
+    if (argc - arg > 3) first_char = atoi(argv[arg+3]);
+    // the strip is cut to fit the characters after first_char
+    if (first_char < 0 || first_char >= MAX_CHARS) die("bad character range", NULL);
+    read_png(filename, atoi(argv[arg+2]));
+#else
+    die("built without libpng, can't read", filename);
+#endif
+  } else {
+    if (argc - arg > 2) first_char = atoi(argv[arg+2]);
+    if (argc - arg > 3) num_chars = atoi(argv[arg+3]);
+    if (first_char < 0 || num_chars < 1 || first_char + num_chars > MAX_CHARS) {
+      die("bad character range", NULL);
+    }
+    read_bdf(filename);
+  }
+  if (num_chars < 1) die("no characters in", filename);
+
+  write_font(name, filename);
+  return 0;
+}
@@ -0,0 +1,12 @@
+/* File generated automatically from test.bdf */
+
+const uint8_t font_test_narrow_data[] = {
+  0x00, 0x1c, 0x08, 0x11, 0x16, 0x10, 0x0b, 0x09, 0x18, 0x00,
+  0x00, 0x05, 0x05, 0x29, 0x4f, 0x70, 0x49, 0x29, 0x26, 0x00,
+  0x00, 0x04, 0x00, 0x01, 0x03, 0x04, 0x02, 0x06, 0x04, 0x00,
+  0x00, 0x09, 0x32, 0x31, 0x0b, 0x35, 0x34, 0x18, 0x29, 0x00,
+};
+const uint8_t font_test_narrow_advance[] = {
+  6,  8,  4,  7,
+};
+const struct VGA_FONT font_test_narrow = { 8, 10, 67, 4, font_test_narrow_data, font_test_narrow_advance };
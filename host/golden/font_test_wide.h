@@ -0,0 +1,14 @@
+/* File generated automatically from test.bdf */
+
+const uint16_t font_test_wide_wide_data[] = {
+  0x0000, 0x054f, 0x0964, 0x08a6, 0x0565, 0x0a30, 0x0148, 0x0c4b, 0x0491, 0x0000,
+  0x0000, 0x0152, 0x00e0, 0x002e, 0x0102, 0x00d8, 0x0120, 0x00d0, 0x01ec, 0x0000,
+  0x0000, 0x001c, 0x0008, 0x0011, 0x0016, 0x0010, 0x000b, 0x0009, 0x0018, 0x0000,
+  0x0000, 0x0005, 0x0005, 0x0029, 0x004f, 0x0070, 0x0049, 0x0029, 0x0026, 0x0000,
+  0x0000, 0x0004, 0x0000, 0x0001, 0x0003, 0x0004, 0x0002, 0x0006, 0x0004, 0x0000,
+  0x0000, 0x0009, 0x0032, 0x0031, 0x000b, 0x0035, 0x0034, 0x0018, 0x0029, 0x0000,
+};
+const uint8_t font_test_wide_advance[] = {
+ 13, 10,  6,  8,  4,  7,
+};
+const struct VGA_FONT font_test_wide = { 13, 10, 65, 6, NULL, font_test_wide_advance, font_test_wide_wide_data };
@@ -0,0 +1,426 @@
+/**
+ * pio_check.c
+ *
+ * Checks that the hand-maintained host copy of the pioasm output
+ * (host/vga_6bit.pio.h) matches vga_6bit.pio: each program is
+ * assembled here and its instructions and wrap points are compared
+ * with the ones in the header, and every line of the %c-sdk blocks
+ * must appear in the header in the same order.  Only the instructions
+ * and directives vga_6bit.pio uses are supported.
+ *
+ * Usage: pio_check vga_6bit.pio vga_6bit.pio.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#define MAX_PROGRAMS 8
+#define MAX_INSTR    32
+#define MAX_LABELS   32
+#define MAX_LINES    1024
+#define MAX_WORDS    8
+
+struct LABEL {
+  char name[64];
+  int addr;
+};
+
+struct PROGRAM {
+  char name[64];
+  int len;
+  int wrap_target;
+  int wrap;
+  int sideset_count;     // side-set bits, including the enable bit with opt
+  bool sideset_opt;
+  bool sideset_pindirs;
+  char source[MAX_INSTR][128];
+  int line_num[MAX_INSTR];
+  struct LABEL labels[MAX_LABELS];
+  int num_labels;
+  uint16_t instr[MAX_INSTR];
+};
+
+static struct PROGRAM programs[MAX_PROGRAMS];
+static int num_programs;
+static char *sdk_lines[MAX_LINES];
+static int num_sdk_lines;
+static const char *pio_filename;
+static int errors;
+
+static void error(int line_num, const char *msg, const char *arg)
+{
+  printf("%s:%d: %s%s%s\n", pio_filename, line_num, msg, (arg) ? ": " : "", (arg) ? arg : "");
+  errors++;
+}
+
+static char *trim(char *str)
+{
+  while (isspace((unsigned char) *str)) str++;
+  char *end = str + strlen(str);
+  while (end > str && isspace((unsigned char) end[-1])) *--end = '\0';
+  return str;
+}
+
+// Returns the index of word in list (NULL-terminated), or -1
+static int lookup(const char *word, const char *const *list)
+{
+  for (int i = 0; list[i]; i++) {
+    if (list[i][0] != '\0' && strcmp(word, list[i]) == 0) return i;
+  }
+  return -1;
+}
+
+static int parse_number(const char *word, int line_num)
+{
+  char *end;
+  long n = strtol(word, &end, 0);
+  if (*word == '\0' || *end != '\0') {
+    error(line_num, "bad number", word);
+    return 0;
+  }
+  return (int) n;
+}
+
+// === ASSEMBLER ====================================================
+
+static const char *const jmp_conds[]  = { "", "!x", "x--", "!y", "y--", "x!=y", "pin", "!osre", NULL };
+static const char *const wait_srcs[]  = { "gpio", "pin", "irq", NULL };
+static const char *const in_srcs[]    = { "pins", "x", "y", "null", "", "", "isr", "osr", NULL };
+static const char *const out_dests[]  = { "pins", "x", "y", "null", "pindirs", "pc", "isr", "exec", NULL };
+static const char *const mov_dests[]  = { "pins", "x", "y", "", "exec", "pc", "isr", "osr", NULL };
+static const char *const mov_srcs[]   = { "pins", "x", "y", "null", "", "status", "isr", "osr", NULL };
+static const char *const set_dests[]  = { "pins", "x", "y", "", "pindirs", NULL };
+
+static int find_label(const struct PROGRAM *prog, const char *name)
+{
+  for (int i = 0; i < prog->num_labels; i++) {
+    if (strcmp(prog->labels[i].name, name) == 0) return prog->labels[i].addr;
+  }
+  return -1;
+}
+
+static int operand(const char *word, const char *const *list, int line_num)
+{
+  int n = lookup(word, list);
+  if (n < 0) error(line_num, "unsupported operand", word);
+  return (n < 0) ? 0 : n;
+}
+
+static uint16_t assemble(const struct PROGRAM *prog, char *text, int line_num)
+{
+  // delay
+  int delay = 0;
+  char *bracket = strchr(text, '[');
+  if (bracket) {
+    delay = atoi(bracket + 1);
+    *bracket = '\0';
+  }
+
+  // words separated by spaces and commas
+  char *words[MAX_WORDS];
+  int num_words = 0;
+  for (char *w = strtok(text, " \t,"); w && num_words < MAX_WORDS; w = strtok(NULL, " \t,")) {
+    words[num_words++] = w;
+  }
+
+  // side-set, in the top bits of the delay field
+  int delay_bits = 5 - prog->sideset_count;
+  uint16_t instr = 0;
+  if (num_words > 2 && strcmp(words[num_words-2], "side") == 0) {
+    if (prog->sideset_count == 0) error(line_num, "side-set not enabled", NULL);
+    int value = parse_number(words[num_words-1], line_num);
+    if (prog->sideset_opt) value |= 1 << (prog->sideset_count - 1);
+    instr |= value << (8 + delay_bits);
+    num_words -= 2;
+  } else if (prog->sideset_count > 0 && ! prog->sideset_opt) {
+    error(line_num, "side-set required", NULL);
+  }
+  if (delay >= (1 << delay_bits)) error(line_num, "delay too long", NULL);
+  instr |= delay << 8;
+
+  if (num_words == 0) return 0;
+  const char *op = words[0];
+  const char *arg1 = (num_words > 1) ? words[1] : "";
+  const char *arg2 = (num_words > 2) ? words[2] : "";
+  const char *arg3 = (num_words > 3) ? words[3] : "";
+
+  if (strcmp(op, "jmp") == 0) {
+    int cond = (num_words > 2) ? operand(arg1, jmp_conds, line_num) : 0;
+    const char *target = (num_words > 2) ? arg2 : arg1;
+    int addr = find_label(prog, target);
+    if (addr < 0) addr = parse_number(target, line_num);
+    return instr | 0x0000 | (cond << 5) | addr;
+  }
+  if (strcmp(op, "wait") == 0) {
+    return instr | 0x2000 | (parse_number(arg1, line_num) << 7) |
+      (operand(arg2, wait_srcs, line_num) << 5) | parse_number(arg3, line_num);
+  }
+  if (strcmp(op, "in") == 0) {
+    return instr | 0x4000 | (operand(arg1, in_srcs, line_num) << 5) | (parse_number(arg2, line_num) & 0x1f);
+  }
+  if (strcmp(op, "out") == 0) {
+    return instr | 0x6000 | (operand(arg1, out_dests, line_num) << 5) | (parse_number(arg2, line_num) & 0x1f);
+  }
+  if (strcmp(op, "push") == 0 || strcmp(op, "pull") == 0) {
+    bool pull = (strcmp(op, "pull") == 0);
+    bool block = true;
+    bool if_full = false;
+    for (int i = 1; i < num_words; i++) {
+      if (strcmp(words[i], "noblock") == 0) block = false;
+      else if (strcmp(words[i], "block") == 0) block = true;
+      else if (strcmp(words[i], (pull) ? "ifempty" : "iffull") == 0) if_full = true;
+      else error(line_num, "unsupported operand", words[i]);
+    }
+    return instr | 0x8000 | (pull << 7) | (if_full << 6) | (block << 5);
+  }
+  if (strcmp(op, "mov") == 0) {
+    int mov_op = 0;
+    if (*arg2 == '!' || *arg2 == '~') {
+      mov_op = 1;
+      arg2++;
+    } else if (strncmp(arg2, "::", 2) == 0) {
+      mov_op = 2;
+      arg2 += 2;
+    }
+    return instr | 0xa000 | (operand(arg1, mov_dests, line_num) << 5) | (mov_op << 3) |
+      operand(arg2, mov_srcs, line_num);
+  }
+  if (strcmp(op, "irq") == 0) {
+    int mode = 0;   // set, nowait
+    const char *index = arg1;
+    if (num_words > 2) {
+      if (strcmp(arg1, "wait") == 0) mode = 1;
+      else if (strcmp(arg1, "clear") == 0) mode = 2;
+      else if (strcmp(arg1, "set") != 0 && strcmp(arg1, "nowait") != 0) error(line_num, "unsupported operand", arg1);
+      index = arg2;
+    }
+    return instr | 0xc000 | (mode << 5) | parse_number(index, line_num);
+  }
+  if (strcmp(op, "set") == 0) {
+    return instr | 0xe000 | (operand(arg1, set_dests, line_num) << 5) | parse_number(arg2, line_num);
+  }
+  if (strcmp(op, "nop") == 0) {
+    return instr | 0xa042;   // mov y, y
+  }
+  error(line_num, "unsupported instruction", op);
+  return 0;
+}
+
+static void read_pio(const char *filename)
+{
+  FILE *f = fopen(filename, "r");
+  if (! f) {
+    printf("can't open %s\n", filename);
+    exit(1);
+  }
+
+  char line[256];
+  int line_num = 0;
+  bool in_sdk = false;
+  struct PROGRAM *prog = NULL;
+  while (fgets(line, sizeof(line), f)) {
+    line_num++;
+    if (in_sdk) {
+      if (strncmp(line, "%}", 2) == 0) {
+        in_sdk = false;
+      } else if (*trim(line) != '\0' && num_sdk_lines < MAX_LINES) {
+        sdk_lines[num_sdk_lines++] = strdup(trim(line));
+      }
+      continue;
+    }
+
+    char *comment = strstr(line, "//");
+    if (comment) *comment = '\0';
+    comment = strchr(line, ';');
+    if (comment) *comment = '\0';
+    char *text = trim(line);
+    if (*text == '\0') continue;
+
+    if (strncmp(text, "%c-sdk", 6) == 0) {
+      in_sdk = true;
+    } else if (strncmp(text, ".program", 8) == 0) {
+      if (num_programs == MAX_PROGRAMS) {
+        error(line_num, "too many programs", NULL);
+        break;
+      }
+      prog = &programs[num_programs++];
+      snprintf(prog->name, sizeof(prog->name), "%s", trim(text + 8));
+      prog->wrap_target = 0;
+      prog->wrap = -1;
+    } else if (! prog) {
+      error(line_num, "outside of a program", text);
+    } else if (strcmp(text, ".wrap_target") == 0) {
+      prog->wrap_target = prog->len;
+    } else if (strcmp(text, ".wrap") == 0) {
+      prog->wrap = prog->len - 1;
+    } else if (strncmp(text, ".side_set", 9) == 0) {
+      char *args = trim(text + 9);
+      char *count = strtok(args, " \t");
+      prog->sideset_count = (count) ? parse_number(count, line_num) : 0;
+      for (char *w = strtok(NULL, " \t"); w; w = strtok(NULL, " \t")) {
+        if (strcmp(w, "opt") == 0) prog->sideset_opt = true;
+        else if (strcmp(w, "pindirs") == 0) prog->sideset_pindirs = true;
+        else error(line_num, "unsupported operand", w);
+      }
+      if (prog->sideset_opt) prog->sideset_count++;
+    } else if (*text == '.') {
+      error(line_num, "unsupported directive", text);
+    } else if (text[strlen(text) - 1] == ':') {
+      if (prog->num_labels < MAX_LABELS) {
+        struct LABEL *label = &prog->labels[prog->num_labels++];
+        text[strlen(text) - 1] = '\0';
+        snprintf(label->name, sizeof(label->name), "%s", trim(text));
+        label->addr = prog->len;
+      }
+    } else if (prog->len < MAX_INSTR) {
+      snprintf(prog->source[prog->len], sizeof(prog->source[0]), "%s", text);
+      prog->line_num[prog->len++] = line_num;
+    } else {
+      error(line_num, "program too long", prog->name);
+    }
+  }
+  fclose(f);
+
+  // labels can be used before they're defined, so assemble at the end
+  for (int p = 0; p < num_programs; p++) {
+    prog = &programs[p];
+    if (prog->wrap < 0) prog->wrap = prog->len - 1;
+    for (int i = 0; i < prog->len; i++) {
+      char text[sizeof(prog->source[i])];
+      strcpy(text, prog->source[i]);
+      prog->instr[i] = assemble(prog, text, prog->line_num[i]);
+    }
+  }
+}
+
+// === HEADER =======================================================
+
+static char *read_file(const char *filename)
+{
+  FILE *f = fopen(filename, "rb");
+  if (! f) {
+    printf("can't open %s\n", filename);
+    exit(1);
+  }
+  fseek(f, 0, SEEK_END);
+  long size = ftell(f);
+  fseek(f, 0, SEEK_SET);
+  char *data = malloc(size + 1);
+  if (! data || fread(data, 1, size, f) != (size_t) size) {
+    printf("can't read %s\n", filename);
+    exit(1);
+  }
+  data[size] = '\0';
+  fclose(f);
+  return data;
+}
+
+static int header_define(const char *header, const char *name, const char *suffix)
+{
+  char define[128];
+  snprintf(define, sizeof(define), "#define %s_%s ", name, suffix);
+  const char *p = strstr(header, define);
+  return (p) ? atoi(p + strlen(define)) : -1;
+}
+
+static void check_program(const char *header, const char *header_filename, const struct PROGRAM *prog)
+{
+  int prog_errors = 0;
+  char decl[128];
+  snprintf(decl, sizeof(decl), "%s_program_instructions[] = {", prog->name);
+  const char *p = strstr(header, decl);
+  if (! p) {
+    printf("%s: %s: no instructions\n", header_filename, prog->name);
+    errors++;
+    return;
+  }
+  p += strlen(decl);
+
+  // one instruction per line, comments start with "//"
+  const char *end = strstr(p, "};");
+  int len = 0;
+  while (p && p < end) {
+    const char *hex = strstr(p, "0x");
+    const char *comment = strstr(p, "//");
+    if (hex && hex < end && (! comment || hex < comment)) {
+      uint16_t instr = (uint16_t) strtoul(hex, NULL, 16);
+      if (len >= prog->len) {
+        printf("%s: %s: extra instruction 0x%04x\n", header_filename, prog->name, instr);
+        prog_errors++;
+      } else if (instr != prog->instr[len]) {
+        printf("%s: %s: instruction %d is 0x%04x, '%s' is 0x%04x\n", header_filename, prog->name,
+               len, instr, prog->source[len], prog->instr[len]);
+        prog_errors++;
+      }
+      len++;
+    }
+    p = strchr(p, '\n');
+    if (p) p++;
+  }
+  if (len < prog->len) {
+    printf("%s: %s: %d instructions, expected %d\n", header_filename, prog->name, len, prog->len);
+    prog_errors++;
+  }
+
+  if (header_define(header, prog->name, "wrap_target") != prog->wrap_target ||
+      header_define(header, prog->name, "wrap") != prog->wrap) {
+    printf("%s: %s: wrap points are not %d and %d\n", header_filename, prog->name, prog->wrap_target, prog->wrap);
+    prog_errors++;
+  }
+
+  // the default config sets up side-set, between the function name and the next "}"
+  snprintf(decl, sizeof(decl), "%s_program_get_default_config(uint offset) {", prog->name);
+  p = strstr(header, decl);
+  end = (p) ? strchr(p, '}') : NULL;
+  char sideset[128];
+  snprintf(sideset, sizeof(sideset), "sm_config_set_sideset(&c, %d, %s, %s);", prog->sideset_count,
+           prog->sideset_opt ? "true" : "false", prog->sideset_pindirs ? "true" : "false");
+  const char *found = (p) ? strstr(p, sideset) : NULL;
+  if (! p || (prog->sideset_count > 0) != (found && found < end)) {
+    printf("%s: %s: default config doesn't match '.side_set'\n", header_filename, prog->name);
+    prog_errors++;
+  }
+
+  printf("%s: %d instructions %s\n", prog->name, prog->len, prog_errors ? "FAILED" : "OK");
+  errors += prog_errors;
+}
+
+// the %c-sdk lines must be in the header in the same order
+static void check_sdk_code(const char *header, const char *header_filename)
+{
+  const char *p = header;
+  for (int i = 0; i < num_sdk_lines; i++) {
+    const char *found = strstr(p, sdk_lines[i]);
+    if (! found) {
+      printf("%s: missing or out of order: %s\n", header_filename, sdk_lines[i]);
+      errors++;
+      return;
+    }
+    p = found + strlen(sdk_lines[i]);
+  }
+  printf("c-sdk code: %d lines OK\n", num_sdk_lines);
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc != 3) {
+    fprintf(stderr, "USAGE: %s file.pio file.pio.h\n", argv[0]);
+    return 1;
+  }
+  pio_filename = argv[1];
+  read_pio(argv[1]);
+  char *header = read_file(argv[2]);
+
+  for (int p = 0; p < num_programs; p++) {
+    check_program(header, argv[2], &programs[p]);
+  }
+  check_sdk_code(header, argv[2]);
+
+  free(header);
+  printf("%s: %s\n", argv[2], errors ? "FAILED" : "OK");
+  return errors != 0;
+}
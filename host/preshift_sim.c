@@ -0,0 +1,135 @@
+/**
+ * preshift_sim.c
+ *
+ * Draws sprites made pre-shifted by draw_preshift_sprite() (drawn by
+ * render_preshifted() at every x that's not a multiple of 4) and
+ * checks every pixel of the framebuffer against a reference that
+ * draws the image a pixel at a time.  The sprites have pseudo-random
+ * sizes, pixels (a quarter of them transparent) and positions,
+ * including positions clipped at every edge of the screen, and are
+ * drawn with and without DRAW_TRANSPARENT over a background that's
+ * different in every pixel.
+ *
+ * Usage: preshift_sim [num_sprites]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "vga_draw.h"
+#include "host_sdk.h"
+
+#define MAX_WIDTH   40
+#define MAX_HEIGHT  24
+
+static unsigned int seed = 1;
+static unsigned char *ref;
+static unsigned int image[MAX_HEIGHT * MAX_WIDTH/4];
+
+static unsigned int next_rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) & 0x7fff;
+}
+
+static unsigned char bg_color(int x, int y)
+{
+  return vga_screen.sync_bits | ((x*7 + y*3) & 0x3f);
+}
+
+static void make_sprite(struct SPRITE *spr)
+{
+  memset(spr, 0, sizeof(*spr));
+  spr->width  = 1 + next_rand() % MAX_WIDTH;
+  spr->height = 1 + next_rand() % MAX_HEIGHT;
+  spr->stride = (spr->width + 3) / 4;
+  spr->data   = image;
+  for (int y = 0; y < spr->height; y++) {
+    unsigned char *line = (unsigned char *) (image + spr->stride*y);
+    for (int x = 0; x < (int) spr->stride*4; x++) {
+      unsigned char pix = next_rand() & 0x3f;
+      if (next_rand() % 4 == 0) pix = 0x0c;
+      line[x] = vga_screen.sync_bits | pix;
+    }
+  }
+}
+
+static void ref_sprite(const struct SPRITE *spr, int spr_x, int spr_y, unsigned int flags)
+{
+  for (int y = 0; y < spr->height; y++) {
+    const unsigned char *line = (const unsigned char *) (spr->data + spr->stride*y);
+    for (int x = 0; x < spr->width; x++) {
+      int px = spr_x + x;
+      int py = spr_y + y;
+      if (px < 0 || px >= vga_screen.width || py < 0 || py >= vga_screen.height) continue;
+      if ((flags & DRAW_TRANSPARENT) && (line[x] & 0x3f) == 0x0c) continue;
+      ref[py * vga_screen.width + px] = line[x];
+    }
+  }
+}
+
+static int check_sprite(struct SPRITE *spr, int spr_x, int spr_y, unsigned int flags)
+{
+  for (int py = 0; py < vga_screen.height; py++) {
+    unsigned char *line = (unsigned char *) vga_screen.framebuffer[py];
+    for (int px = 0; px < vga_screen.width; px++) {
+      line[px] = ref[py * vga_screen.width + px] = bg_color(px, py);
+    }
+  }
+  ref_sprite(spr, spr_x, spr_y, flags);
+  draw_sprite(spr, spr_x, spr_y, flags);
+
+  for (int py = 0; py < vga_screen.height; py++) {
+    const unsigned char *line = (const unsigned char *) vga_screen.framebuffer[py];
+    for (int px = 0; px < vga_screen.width; px++) {
+      unsigned char expected = ref[py * vga_screen.width + px];
+      if (line[px] != expected) {
+        printf("%dx%d sprite at (%d, %d), %s: pixel (%d, %d) is 0x%02x, expected 0x%02x\n",
+               spr->width, spr->height, spr_x, spr_y,
+               (flags & DRAW_TRANSPARENT) ? "transparent" : "opaque",
+               px, py, line[px], expected);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  int num_sprites = (argc > 1) ? atoi(argv[1]) : 1000;
+
+  if (vga_init(&vga_mode_320x240, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  ref = malloc(vga_screen.width * vga_screen.height);
+  if (! ref) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  int errors = 0;
+  for (int i = 0; i < num_sprites && errors < 10; i++) {
+    struct SPRITE spr;
+    make_sprite(&spr);
+    if (! draw_preshift_sprite(&spr, ~0u)) {
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+
+    // anywhere from just off the left/top edge to just off the right/bottom edge
+    int x = -spr.width - 2 + (int) (next_rand() % (vga_screen.width + spr.width + 4));
+    int y = -spr.height - 2 + (int) (next_rand() % (vga_screen.height + spr.height + 4));
+    if ((x & 3) == 0) x++;  // aligned sprites don't use the copies
+    unsigned int flags = (i % 2) ? DRAW_TRANSPARENT : 0;
+    errors += check_sprite(&spr, x, y, flags);
+    draw_free_preshift(&spr);
+  }
+
+  printf("%d pre-shifted sprites: %s\n", num_sprites, errors ? "FAILED" : "OK");
+  free(ref);
+  return errors != 0;
+}
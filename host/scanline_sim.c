@@ -0,0 +1,174 @@
+/**
+ * scanline_sim.c
+ *
+ * Runs the VGA driver in scanline mode on the host, walking the DMA
+ * chain with the emulated DMA controller, and checks that every line
+ * sent to the monitor has the expected sync signals and the pixels
+ * rendered for it by the line callback.
+ *
+ * With VGA_ENABLE_PIO_SYNC the DMA only sends pixels, so the blanking
+ * and sync signals generated by the PIO programs are added to the
+ * stream before checking it.
+ *
+ * Usage: scanline_sim [num_line_buffers] [num_frames]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "host_sdk.h"
+#include "stream.h"
+
+static const struct VGA_MODE *mode = &vga_mode_320x240;
+static int render_frame = -1;
+
+static unsigned char pattern(int frame, int x, int y)
+{
+  return (x*3 + y*7 + frame) & 0x3f;
+}
+
+static void render_line(unsigned int *line, int y)
+{
+  if (y == 0) render_frame++;
+
+  unsigned char *pix = (unsigned char *) line;
+  for (int x = 0; x < vga_screen.width; x++) {
+    pix[x] = vga_screen.sync_bits | pattern(render_frame, x, y);
+  }
+}
+
+#if VGA_ENABLE_PIO_SYNC
+
+static int pio_line_pixels;   // pixels of the current line received so far
+static int pio_frame_lines;   // visible lines of the current frame received so far
+
+// add a line as output by the sync state machines (pixels == NULL for blank lines)
+static void add_pio_line(const uint8_t *pixels, bool vsync)
+{
+  uint8_t hsync_off = (!!mode->h_polarity) << 6;
+  uint8_t vsync_bit = (vsync ? !mode->v_polarity : !!mode->v_polarity) << 7;
+  for (int x = 0; x < mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch; x++) {
+    bool hsync = (x >= mode->h_front_porch && x < mode->h_front_porch + mode->h_sync_pulse);
+    stream_add(vsync_bit | (hsync ? hsync_off ^ 0x40 : hsync_off));
+  }
+  for (int x = 0; x < mode->h_pixels; x++) {
+    stream_add(vsync_bit | hsync_off | (pixels ? pixels[x] & 0x3f : 0));
+  }
+}
+
+static void pio_tx(PIO pio, uint sm, uint32_t data)
+{
+  (void) pio;
+  (void) sm;
+  static uint8_t line[1024];
+  for (int i = 0; i < 4; i++) {
+    line[pio_line_pixels++] = (data >> (8*i)) & 0xff;
+  }
+  if (pio_line_pixels < mode->h_pixels) return;
+
+  pio_line_pixels = 0;
+  add_pio_line(line, false);
+  if (++pio_frame_lines < mode->v_pixels) return;
+
+  pio_frame_lines = 0;
+  for (int i = 0; i < mode->v_front_porch + mode->v_sync_pulse + mode->v_back_porch; i++) {
+    add_pio_line(NULL, i >= mode->v_front_porch && i < mode->v_front_porch + mode->v_sync_pulse);
+  }
+}
+
+#endif
+
+enum LINE_TYPE { LINE_VSYNC, LINE_BLANK, LINE_VISIBLE };
+
+static int check_stream(int num_frames)
+{
+  int h_blank   = mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch;
+  int h_full    = h_blank + mode->h_pixels;
+  int v_full    = mode->v_front_porch + mode->v_sync_pulse + mode->v_back_porch + mode->v_pixels;
+  int v_visible = mode->v_sync_pulse + mode->v_back_porch;
+  uint8_t hsync_on = (!mode->h_polarity) << 6;
+  uint8_t vsync_on = (!mode->v_polarity) << 7;
+  int num_lines = stream_len / h_full;
+
+  // find where the stream starts relative to the start of vsync
+  int first_vsync = -1;
+  for (int i = 0; i < num_lines; i++) {
+    if ((stream[i*h_full] & 0x80) == vsync_on) {
+      first_vsync = i;
+      break;
+    }
+  }
+  if (first_vsync < 0) {
+    printf("no vsync found in %d lines\n", num_lines);
+    return 1;
+  }
+  int phase = (v_full - first_vsync % v_full) % v_full;
+
+  int errors = 0;
+  int frame = 0;
+  int frames_checked = 0;
+  bool in_visible = false;
+  for (int i = 0; i < num_lines && frame < num_frames; i++) {
+    const uint8_t *line = &stream[i*h_full];
+    int v = (phase + i) % v_full;
+    enum LINE_TYPE type = ((v < mode->v_sync_pulse) ? LINE_VSYNC :
+                           (v < v_visible || v >= v_visible + mode->v_pixels) ? LINE_BLANK : LINE_VISIBLE);
+    if (in_visible && type != LINE_VISIBLE) {
+      frame++;
+      frames_checked++;
+    }
+    in_visible = (type == LINE_VISIBLE);
+
+    for (int x = 0; x < h_full; x++) {
+      uint8_t exp = (((x >= mode->h_front_porch && x < mode->h_front_porch + mode->h_sync_pulse) ? hsync_on : hsync_on ^ 0x40) |
+                     ((type == LINE_VSYNC) ? vsync_on : vsync_on ^ 0x80));
+      if (type == LINE_VISIBLE && x >= h_blank) {
+        exp |= pattern(frame, x - h_blank, (v - v_visible) / mode->v_div);
+      }
+      if (line[x] != exp) {
+        if (errors++ < 10) {
+          printf("frame %d, line %d, byte %d: got 0x%02x, expected 0x%02x\n", frame, v, x, line[x], exp);
+        }
+        break;
+      }
+    }
+  }
+  if (frames_checked < num_frames) {
+    printf("only %d of %d frames were output\n", frames_checked, num_frames);
+    return 1;
+  }
+  if (errors > 0) {
+    printf("%d bad lines\n", errors);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  int num_line_buffers = (argc > 1) ? atoi(argv[1]) : 2;
+  int num_frames       = (argc > 2) ? atoi(argv[2]) : 3;
+
+#if VGA_ENABLE_PIO_SYNC
+  host_pio_set_tx_func(pio_tx);
+#else
+  stream_capture_dma();
+#endif
+  if (vga_init_scanline(mode, 2, num_line_buffers, render_line) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+
+  // run one frame more than checked, since the stream may not start at a frame boundary
+  int h_full = mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch + mode->h_pixels;
+  int v_full = mode->v_front_porch + mode->v_sync_pulse + mode->v_back_porch + mode->v_pixels;
+  if (stream_run_dma((size_t) (num_frames+1) * v_full * h_full) != 0) return 1;
+
+  int ret = check_stream(num_frames);
+  printf("%dx%d, %d line buffers: %d frames %s, %u late lines, budget %u cycles/line\n",
+         vga_screen.width, vga_screen.height, num_line_buffers, num_frames, ret ? "FAILED" : "OK",
+         vga_scanline_late_lines(), vga_scanline_budget_cycles());
+  return ret;
+}
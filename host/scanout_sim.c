@@ -0,0 +1,281 @@
+/**
+ * scanout_sim.c
+ *
+ * Replays the DMA chain built in framebuffer mode (the emulated DMA
+ * controller follows each block's read_addr, transfer_count and the
+ * restart block exactly as the control and data channels do) and
+ * decodes the byte stream sent to the PIO the way a monitor would:
+ * each line is measured from the start of its hsync pulse (pulse
+ * width, back porch, visible pixels, front porch, and vsync may only
+ * change in the front porch or with the hsync edge) and each frame from
+ * the start of its vsync pulse, and every line and frame is checked
+ * against the VGA_MODE.  Also reports the sync frequencies and the
+ * number of DMA blocks loaded per frame.
+ *
+ * With VGA_ENABLE_PIO_SYNC the DMA only sends pixels, so the state
+ * machines are emulated running the programs in vga_6bit.pio, and
+ * their output pins are sampled once per pixel (the state machines run
+ * at twice the pixel clock) and decoded instead.  The state machine
+ * sending pixels must never run out of them.
+ *
+ * Usage: scanout_sim [-o stream_file] [240|200] [num_frames]
+ *
+ *   -o  write the decoded stream, one byte per pixel clock (6 color
+ *       bits, hsync and vsync), to the file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "vga_6bit.h"
+#include "host_sdk.h"
+#include "stream.h"
+
+#define MAX_ERRORS 10
+#define PIN_BASE   2
+
+static const struct VGA_MODE *mode = &vga_mode_320x240;
+
+static int errors;
+
+static void check(const char *what, int num, int got, int expected)
+{
+  if (got == expected) return;
+  if (errors++ < MAX_ERRORS) {
+    printf("%s %d: got %d, expected %d\n", what, num, got, expected);
+  }
+}
+
+// Fill every framebuffer with colors that are never black, so the
+// visible area can be told apart from the blanking.
+static void fill_framebuffers(void)
+{
+  for (int i = 0; i < 2; i++) {
+    for (int y = 0; y < vga_screen.height; y++) {
+      unsigned char *line = (unsigned char *) vga_screen.framebuffer[y];
+      for (int x = 0; x < vga_screen.width; x++) {
+        line[x] = vga_screen.sync_bits | (1 + (x + y) % 63);
+      }
+    }
+    vga_swap_buffers(true);
+  }
+}
+
+// Run until the stream has num_frames frames
+static int run_frames(int num_frames, size_t frame_len)
+{
+#if VGA_ENABLE_PIO_SYNC
+  return stream_run_pins(num_frames * frame_len, PIN_BASE);
+#else
+  return stream_run_dma(num_frames * frame_len);
+#endif
+}
+
+struct LINE {
+  int len;
+  int sync;
+  int vis_start;
+  int vis_end;     // vis_start == vis_end for blank lines
+  bool vsync;      // vsync active at the start of the hsync pulse
+  int vsync_edge;  // where vsync changes inside the line, or 0
+};
+
+// Returns the sync level that's active: the one seen the least
+static uint8_t active_level(uint8_t bit)
+{
+  size_t set = 0;
+  for (size_t i = 0; i < stream_len; i++) {
+    if (stream[i] & bit) set++;
+  }
+  return (set < stream_len - set) ? bit : 0;
+}
+
+// Split the stream into lines starting at each hsync pulse
+static int decode_lines(struct LINE *lines, int max_lines, uint8_t hsync_on, uint8_t vsync_on)
+{
+  int num_lines = 0;
+  size_t start = 0;
+  bool started = false;
+  for (size_t i = 1; i <= stream_len; i++) {
+    bool end = (i == stream_len ||
+                ((stream[i] & 0x40) == hsync_on && (stream[i-1] & 0x40) != hsync_on));
+    if (! end) continue;
+
+    // the stream starts in the middle of a line
+    if (started && num_lines < max_lines) {
+      struct LINE *line = &lines[num_lines++];
+      line->len = i - start;
+      line->sync = 0;
+      while (line->sync < line->len && (stream[start + line->sync] & 0x40) == hsync_on) line->sync++;
+      line->vis_start = line->vis_end = 0;
+      for (int x = 0; x < line->len; x++) {
+        if (stream[start + x] & 0x3f) {
+          if (line->vis_end == 0) line->vis_start = x;
+          line->vis_end = x + 1;
+        }
+      }
+      line->vsync = (stream[start] & 0x80) == vsync_on;
+      line->vsync_edge = 0;
+      for (int x = 1; x < line->len && line->vsync_edge == 0; x++) {
+        if ((stream[start + x] & 0x80) != (stream[start] & 0x80)) line->vsync_edge = x;
+      }
+    }
+    started = true;
+    start = i;
+  }
+
+  // the last line may be incomplete
+  return (num_lines > 0) ? num_lines - 1 : 0;
+}
+
+static void check_line(int num, const struct LINE *line)
+{
+  int h_full = mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch + mode->h_pixels;
+  check("line length, line", num, line->len, h_full);
+  check("hsync pulse, line", num, line->sync, mode->h_sync_pulse);
+  if (line->vsync_edge != 0 && line->vsync_edge < line->len - mode->h_front_porch) {
+    check("vsync edge outside the front porch, line", num, line->vsync_edge, line->len - mode->h_front_porch);
+  }
+  if (line->vis_end > line->vis_start) {
+    check("h back porch, line", num, line->vis_start - line->sync, mode->h_back_porch);
+    check("visible pixels, line", num, line->vis_end - line->vis_start, mode->h_pixels);
+    check("h front porch, line", num, line->len - line->vis_end, mode->h_front_porch);
+  }
+}
+
+// Check each frame from the start of its vsync pulse, returns the
+// number of complete frames
+static int check_frames(const struct LINE *lines, int num_lines)
+{
+  int num_frames = 0;
+  int frame_start = -1;
+  for (int i = 1; i <= num_lines; i++) {
+    bool end = (i == num_lines || (lines[i].vsync && ! lines[i-1].vsync));
+    if (! end) continue;
+    if (i == num_lines || frame_start < 0) {
+      frame_start = i;
+      continue;
+    }
+
+    int l = frame_start;
+    int sync = 0, back_porch = 0, visible = 0, front_porch = 0;
+    while (l < i && lines[l].vsync) { sync++; l++; }
+    while (l < i && lines[l].vis_end == lines[l].vis_start) { back_porch++; l++; }
+    while (l < i && lines[l].vis_end > lines[l].vis_start) { visible++; l++; }
+    while (l < i && lines[l].vis_end == lines[l].vis_start && ! lines[l].vsync) { front_porch++; l++; }
+    check("vsync pulse, frame", num_frames, sync, mode->v_sync_pulse);
+    check("v back porch, frame", num_frames, back_porch, mode->v_back_porch);
+    check("visible lines, frame", num_frames, visible, mode->v_pixels);
+    check("v front porch, frame", num_frames, front_porch, mode->v_front_porch);
+    check("unexpected lines, frame", num_frames, i - l, 0);
+
+    num_frames++;
+    frame_start = i;
+  }
+  return num_frames;
+}
+
+static int check_scanout(int num_frames, size_t frame_len)
+{
+  int max_lines = (num_frames + 2) * (mode->v_front_porch + mode->v_sync_pulse + mode->v_back_porch + mode->v_pixels);
+  struct LINE *lines = malloc(max_lines * sizeof(struct LINE));
+  if (! lines) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+
+  // an extra frame, since the stream may not start at a frame boundary
+  if (run_frames(num_frames + 1, frame_len) != 0) return 1;
+
+  uint8_t hsync_on = active_level(0x40);
+  uint8_t vsync_on = active_level(0x80);
+  check("hsync polarity (0=negative)", 0, hsync_on != 0, ! mode->h_polarity);
+  check("vsync polarity (0=negative)", 0, vsync_on != 0, ! mode->v_polarity);
+
+  int num_lines = decode_lines(lines, max_lines, hsync_on, vsync_on);
+  for (int i = 0; i < num_lines; i++) {
+    check_line(i, &lines[i]);
+  }
+  int frames_checked = check_frames(lines, num_lines);
+  if (frames_checked < num_frames) {
+    printf("only %d of %d frames were decoded\n", frames_checked, num_frames);
+    errors++;
+  }
+
+  printf("hsync %s, %d pixels, back porch %d, visible %d, front porch %d\n",
+         (hsync_on) ? "positive" : "negative", mode->h_sync_pulse, mode->h_back_porch,
+         mode->h_pixels, mode->h_front_porch);
+  printf("vsync %s, %d lines, back porch %d, visible %d, front porch %d\n",
+         (vsync_on) ? "positive" : "negative", mode->v_sync_pulse, mode->v_back_porch,
+         mode->v_pixels, mode->v_front_porch);
+  free(lines);
+  return 0;
+}
+
+static int write_stream(const char *filename)
+{
+  FILE *f = fopen(filename, "wb");
+  if (! f) {
+    printf("can't write %s\n", filename);
+    return 1;
+  }
+  fwrite(stream, 1, stream_len, f);
+  fclose(f);
+  return 0;
+}
+
+static void usage(const char *prog)
+{
+  fprintf(stderr, "USAGE: %s [-o stream_file] [240|200] [num_frames]\n", prog);
+  exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *out_file = NULL;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "o:")) != -1) {
+    switch (opt) {
+    case 'o': out_file = optarg; break;
+    default: usage(argv[0]);
+    }
+  }
+  if (optind < argc && strcmp(argv[optind], "200") == 0) mode = &vga_mode_320x200;
+  int num_frames = (optind + 1 < argc) ? atoi(argv[optind + 1]) : 3;
+
+#if VGA_ENABLE_PIO_SYNC
+  host_pio_set_emulated(true);
+#else
+  stream_capture_dma();
+#endif
+  if (vga_init(mode, PIN_BASE) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  fill_framebuffers();
+  stream_len = 0;
+  uint64_t start_reg_writes = host_dma_reg_writes();
+
+  int h_full = mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch + mode->h_pixels;
+  int v_full = mode->v_front_porch + mode->v_sync_pulse + mode->v_back_porch + mode->v_pixels;
+  size_t frame_len = (size_t) h_full * v_full;
+  vga_reset_stats();
+  if (check_scanout(num_frames, frame_len) != 0) return 1;
+
+  struct VGA_STATS stats;
+  vga_get_stats(&stats);
+  check("underrun frames, run", 0, stats.underrun_frames, 0);
+  if (out_file && write_stream(out_file) != 0) errors++;
+
+  // each block loaded by the control channel writes 4 registers
+  double frames_run = (double) stream_len / frame_len;
+  double hsync_khz = mode->pixel_clock_mhz / 1000.0 / h_full;
+  printf("%dx%d: %.2f kHz hsync, %.2f Hz vsync, %.1f DMA blocks per frame: %d frames %s\n",
+         vga_screen.width, vga_screen.height, hsync_khz, hsync_khz * 1000 / v_full,
+         (double) (host_dma_reg_writes() - start_reg_writes) / 4 / frames_run,
+         num_frames, errors ? "FAILED" : "OK");
+  return errors != 0;
+}
@@ -0,0 +1,1044 @@
+/**
+ * host_sdk.c
+ *
+ * Host implementation of the parts of the Pico SDK used by the VGA
+ * code.  The DMA controller is emulated at register level: channels
+ * copy data exactly as programmed (including ring wrapping, chaining
+ * and trigger aliases) so control blocks built for the real hardware
+ * run unmodified.  Transfers paced by DREQ_FORCE run as soon as they
+ * are triggered (unless host_dma_set_memory_chunk() is used to make
+ * the ones to memory take time); transfers paced by a peripheral only
+ * run when host_dma_step() is called.
+ *
+ * The PIO state machines can also be emulated (host_pio_set_emulated()),
+ * running the loaded programs a cycle at a time; transfers to and from
+ * their FIFOs are then paced by the FIFO levels.
+ *
+ * Registers are pointer-sized on the host, so a transfer whose
+ * destination is a DMA register moves pointer-sized elements.  This
+ * keeps control blocks (which are arrays of register values) working
+ * with 64-bit host addresses.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "pico/platform.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/gpio.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/sync.h"
+#include "hardware/structs/bus_ctrl.h"
+
+#include "host_sdk.h"
+
+#define SYS_CLOCK_KHZ 125000
+
+dma_hw_t host_dma_hw __attribute__((aligned(4096)));
+pio_hw_t host_pio0;
+pio_hw_t host_pio1;
+bus_ctrl_hw_t host_bus_ctrl_hw;
+
+static irq_handler_t irq_handlers[32];
+static uint32_t irq_enabled;
+
+static uint32_t dma_claimed;
+static uint32_t dma_pending;
+static uint32_t dma_irq_pending;
+static bool dma_dispatching;
+static uint64_t dma_pio_words;
+static uint64_t dma_reg_writes;
+static uint32_t dma_memory_chunk;
+static uint32_t dma_remaining[NUM_DMA_CHANNELS];  // elements left of a transfer run in chunks
+
+static spin_lock_t spin_locks[NUM_SPIN_LOCKS];
+static uint32_t spin_locks_claimed;
+
+static uint pio_claimed[2];
+static host_pio_tx_func pio_tx_func;
+static host_pio_read_func pio_read_func;
+
+// === TIME =========================================================
+
+uint64_t time_us_64(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+uint32_t time_us_32(void)
+{
+  return (uint32_t) time_us_64();
+}
+
+absolute_time_t get_absolute_time(void)
+{
+  return time_us_64();
+}
+
+void sleep_ms(uint32_t ms)
+{
+  struct timespec ts = { ms / 1000, (long) (ms % 1000) * 1000000 };
+  nanosleep(&ts, NULL);
+}
+
+// Busy-wait loops are where the hardware would make progress, so run
+// the DMA.
+void tight_loop_contents(void)
+{
+  host_dma_step();
+}
+
+// === MULTICORE ====================================================
+
+static _Thread_local uint core_num;
+
+uint get_core_num(void)
+{
+  return core_num;
+}
+
+static void *core1_thread(void *arg)
+{
+  core_num = 1;
+  ((void (*)(void)) arg)();
+  return NULL;
+}
+
+void multicore_launch_core1(void (*entry)(void))
+{
+  pthread_t thread;
+  if (pthread_create(&thread, NULL, core1_thread, (void *) entry) != 0) {
+    fprintf(stderr, "host: can't start core1 thread\n");
+    abort();
+  }
+  pthread_detach(thread);
+}
+
+// === CLOCKS =======================================================
+
+uint32_t frequency_count_khz(uint src)
+{
+  (void) src;
+  return SYS_CLOCK_KHZ;
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index)
+{
+  (void) clk_index;
+  return SYS_CLOCK_KHZ * 1000;
+}
+
+// === IRQ ==========================================================
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler)
+{
+  irq_handlers[num] = handler;
+}
+
+void irq_set_priority(uint num, uint8_t hardware_priority)
+{
+  (void) num;
+  (void) hardware_priority;
+}
+
+void irq_set_enabled(uint num, bool enabled)
+{
+  if (enabled) {
+    irq_enabled |= 1u << num;
+  } else {
+    irq_enabled &= ~(1u << num);
+  }
+}
+
+// === SYNC =========================================================
+
+spin_lock_t *spin_lock_instance(uint lock_num)
+{
+  return &spin_locks[lock_num];
+}
+
+int spin_lock_claim_unused(bool required)
+{
+  for (uint i = 0; i < NUM_SPIN_LOCKS; i++) {
+    if ((spin_locks_claimed & (1u << i)) == 0) {
+      spin_locks_claimed |= 1u << i;
+      return i;
+    }
+  }
+  if (required) {
+    fprintf(stderr, "host: no free spin lock\n");
+    abort();
+  }
+  return -1;
+}
+
+// === GPIO =========================================================
+
+static uint32_t gpio_out;         // levels driven by the state machines
+static uint32_t gpio_invert;      // pins set to GPIO_OVERRIDE_INVERT
+
+void gpio_set_outover(uint gpio, uint value)
+{
+  if (value == GPIO_OVERRIDE_INVERT) {
+    gpio_invert |= 1u << gpio;
+  } else {
+    gpio_invert &= ~(1u << gpio);
+  }
+}
+
+uint32_t host_gpio_get_all(void)
+{
+  return gpio_out ^ gpio_invert;
+}
+
+// === PIO ==========================================================
+
+// The state machines are only run with host_pio_set_emulated(true):
+// every host_pio_step() runs one clock cycle of each enabled state
+// machine (ignoring clock dividers, the VGA code uses the same one for
+// all of them).  Only the instructions vga_6bit.pio uses are supported.
+
+#define PIO_INSTR_MEM_SIZE 32
+#define PIO_FIFO_DEPTH     4         // twice as deep when joined
+
+struct PIO_SM {
+  pio_sm_config cfg;
+  bool enabled;
+  uint pc;
+  uint delay;               // cycles left of the last instruction's delay
+  uint32_t x, y;
+  uint32_t isr, osr;
+  uint isr_count;           // bits shifted into the ISR
+  uint osr_count;           // bits shifted out of the OSR
+  uint32_t tx_fifo[2*PIO_FIFO_DEPTH];
+  uint tx_len;
+  uint32_t rx_fifo[2*PIO_FIFO_DEPTH];
+  uint rx_len;
+};
+
+struct PIO_STATE {
+  uint16_t instr_mem[PIO_INSTR_MEM_SIZE];
+  uint32_t used_instr;
+  uint8_t irq;
+  uint8_t irq_set;          // IRQ flags set and cleared in this cycle
+  uint8_t irq_clear;
+  struct PIO_SM sm[NUM_PIO_STATE_MACHINES];
+};
+
+static struct PIO_STATE pio_state[2];
+static bool pio_emulated;
+static uint64_t pio_cycles;
+
+static struct PIO_SM *get_sm(PIO pio, uint sm)
+{
+  return &pio_state[pio_get_index(pio)].sm[sm];
+}
+
+static uint tx_fifo_depth(const struct PIO_SM *s)
+{
+  switch (s->cfg.join) {
+  case PIO_FIFO_JOIN_TX: return 2*PIO_FIFO_DEPTH;
+  case PIO_FIFO_JOIN_RX: return 0;
+  default:               return PIO_FIFO_DEPTH;
+  }
+}
+
+static uint rx_fifo_depth(const struct PIO_SM *s)
+{
+  switch (s->cfg.join) {
+  case PIO_FIFO_JOIN_TX: return 0;
+  case PIO_FIFO_JOIN_RX: return 2*PIO_FIFO_DEPTH;
+  default:               return PIO_FIFO_DEPTH;
+  }
+}
+
+static bool tx_pop(struct PIO_SM *s, uint32_t *data)
+{
+  if (s->tx_len == 0) return false;
+  *data = s->tx_fifo[0];
+  memmove(&s->tx_fifo[0], &s->tx_fifo[1], --s->tx_len * sizeof(uint32_t));
+  return true;
+}
+
+static void write_pins(uint base, uint count, uint32_t value)
+{
+  for (uint i = 0; i < count; i++) {
+    uint pin = (base + i) % 32;
+    if (value & (1u << i)) {
+      gpio_out |= 1u << pin;
+    } else {
+      gpio_out &= ~(1u << pin);
+    }
+  }
+}
+
+static uint32_t shift_out(struct PIO_SM *s, uint count)
+{
+  uint32_t data;
+  if (count == 32) {
+    data = s->osr;
+    s->osr = 0;
+  } else if (s->cfg.out_shift_right) {
+    data = s->osr & ((1u << count) - 1);
+    s->osr >>= count;
+  } else {
+    data = s->osr >> (32 - count);
+    s->osr <<= count;
+  }
+  s->osr_count = (s->osr_count + count > 32) ? 32 : s->osr_count + count;
+  return data;
+}
+
+static void unsupported_instr(uint16_t instr)
+{
+  fprintf(stderr, "host: unsupported PIO instruction 0x%04x\n", instr);
+  abort();
+}
+
+static uint32_t mov_src(struct PIO_SM *s, uint16_t instr)
+{
+  switch (instr & 7) {
+  case 1: return s->x;
+  case 2: return s->y;
+  case 3: return 0;
+  case 6: return s->isr;
+  case 7: return s->osr;
+  }
+  unsupported_instr(instr);
+  return 0;
+}
+
+// Executes an instruction, returns false if it stalls.  Sets *jump
+// to the new PC if it jumps.
+static bool exec_instr(PIO pio, uint sm, uint16_t instr, int *jump)
+{
+  struct PIO_STATE *state = &pio_state[pio_get_index(pio)];
+  struct PIO_SM *s = &state->sm[sm];
+  uint index = instr & 0x1f;
+
+  switch (instr >> 13) {
+  case 0: {   // JMP
+    bool cond;
+    switch ((instr >> 5) & 7) {
+    case 0: cond = true; break;
+    case 1: cond = (s->x == 0); break;
+    case 2: cond = (s->x-- != 0); break;
+    case 3: cond = (s->y == 0); break;
+    case 4: cond = (s->y-- != 0); break;
+    case 5: cond = (s->x != s->y); break;
+    case 7: cond = (s->osr_count < s->cfg.pull_threshold); break;
+    default: unsupported_instr(instr); return true;
+    }
+    if (cond) *jump = index;
+    return true;
+  }
+
+  case 1: {   // WAIT
+    bool polarity = (instr >> 7) & 1;
+    if (((instr >> 5) & 3) != 2) unsupported_instr(instr);
+    uint irq = (index & 0x10) ? ((index & 4) | ((index + sm) & 3)) : (index & 7);
+    bool flag = (state->irq >> irq) & 1;
+    if (flag != polarity) return false;
+    if (polarity) state->irq_clear |= 1u << irq;
+    return true;
+  }
+
+  case 3: {   // OUT
+    uint count = (index == 0) ? 32 : index;
+    if (s->cfg.autopull && s->osr_count >= s->cfg.pull_threshold) {
+      if (! tx_pop(s, &s->osr)) {
+        pio->fdebug |= 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+        return false;
+      }
+      s->osr_count = 0;
+    }
+    uint32_t data = shift_out(s, count);
+    switch ((instr >> 5) & 7) {
+    case 0: write_pins(s->cfg.out_base, s->cfg.out_count, data); break;
+    case 1: s->x = data; break;
+    case 2: s->y = data; break;
+    case 3: break;
+    case 5: *jump = data & 0x1f; break;
+    case 6: s->isr = data; s->isr_count = count; break;
+    default: unsupported_instr(instr);
+    }
+    return true;
+  }
+
+  case 4: {   // PUSH, PULL
+    bool if_full = (instr >> 6) & 1;
+    bool block = (instr >> 5) & 1;
+    if (instr & 0x80) {
+      if (if_full && s->osr_count < s->cfg.pull_threshold) return true;
+      if (! tx_pop(s, &s->osr)) {
+        if (block) {
+          pio->fdebug |= 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+          return false;
+        }
+        s->osr = s->x;
+      }
+      s->osr_count = 0;
+    } else {
+      if (if_full && s->isr_count < s->cfg.push_threshold) return true;
+      if (s->rx_len == rx_fifo_depth(s)) {
+        if (block) return false;
+      } else {
+        s->rx_fifo[s->rx_len++] = s->isr;
+      }
+      s->isr = 0;
+      s->isr_count = 0;
+    }
+    return true;
+  }
+
+  case 5: {   // MOV
+    if ((instr >> 3) & 3) unsupported_instr(instr);
+    uint32_t data = mov_src(s, instr);
+    switch ((instr >> 5) & 7) {
+    case 0: write_pins(s->cfg.out_base, s->cfg.out_count, data); break;
+    case 1: s->x = data; break;
+    case 2: s->y = data; break;
+    case 5: *jump = data & 0x1f; break;
+    case 6: s->isr = data; s->isr_count = 0; break;
+    case 7: s->osr = data; s->osr_count = 0; break;
+    default: unsupported_instr(instr);
+    }
+    return true;
+  }
+
+  case 6: {   // IRQ
+    uint irq = (index & 0x10) ? ((index & 4) | ((index + sm) & 3)) : (index & 7);
+    if (instr & 0x20) unsupported_instr(instr);   // irq wait
+    if (instr & 0x40) {
+      state->irq_clear |= 1u << irq;
+    } else {
+      state->irq_set |= 1u << irq;
+    }
+    return true;
+  }
+
+  case 7:     // SET
+    switch ((instr >> 5) & 7) {
+    case 0: write_pins(s->cfg.set_base, s->cfg.set_count, index); break;
+    case 1: s->x = index; break;
+    case 2: s->y = index; break;
+    case 4: break;
+    default: unsupported_instr(instr);
+    }
+    return true;
+  }
+
+  unsupported_instr(instr);
+  return true;
+}
+
+// IRQ flags set or cleared in a cycle are seen in the next one
+static void update_irq_flags(struct PIO_STATE *state)
+{
+  state->irq = (state->irq & ~state->irq_clear) | state->irq_set;
+  state->irq_set = 0;
+  state->irq_clear = 0;
+}
+
+static void step_sm(PIO pio, uint sm)
+{
+  struct PIO_STATE *state = &pio_state[pio_get_index(pio)];
+  struct PIO_SM *s = &state->sm[sm];
+  if (s->delay > 0) {
+    s->delay--;
+    return;
+  }
+
+  // side-set takes effect even if the instruction stalls
+  uint16_t instr = state->instr_mem[s->pc];
+  uint sideset_bits = s->cfg.sideset_bits;
+  uint delay_bits = 5 - sideset_bits;
+  uint sideset = (instr >> (8 + delay_bits)) & ((1u << sideset_bits) - 1);
+  uint sideset_pins = sideset_bits;
+  if (s->cfg.sideset_optional && sideset_bits > 0) {
+    sideset_pins--;
+    if (! (sideset & (1u << sideset_pins))) sideset_pins = 0;
+  }
+  if (sideset_pins > 0 && ! s->cfg.sideset_pindirs) {
+    write_pins(s->cfg.sideset_base, sideset_pins, sideset);
+  }
+
+  int jump = -1;
+  if (! exec_instr(pio, sm, instr, &jump)) return;
+  if (jump >= 0) {
+    s->pc = jump;
+  } else {
+    s->pc = (s->pc == s->cfg.wrap) ? s->cfg.wrap_target : s->pc + 1;
+  }
+  s->delay = (instr >> 8) & ((1u << delay_bits) - 1);
+}
+
+void host_pio_set_emulated(bool emulated)
+{
+  pio_emulated = emulated;
+}
+
+void host_pio_set_tx_func(host_pio_tx_func func)
+{
+  pio_tx_func = func;
+}
+
+void host_pio_set_read_func(host_pio_read_func func)
+{
+  pio_read_func = func;
+}
+
+void host_pio_set_tx_stall(PIO pio, uint sm)
+{
+  pio->fdebug |= 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+}
+
+int pio_claim_unused_sm(PIO pio, bool required)
+{
+  uint *claimed = &pio_claimed[pio_get_index(pio)];
+  for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++) {
+    if ((*claimed & (1u << sm)) == 0) {
+      *claimed |= 1u << sm;
+      return sm;
+    }
+  }
+  if (required) {
+    fprintf(stderr, "host: no free PIO state machine\n");
+    abort();
+  }
+  return -1;
+}
+
+// Like the SDK, programs are loaded at the highest free offset and
+// their jumps relocated
+uint pio_add_program(PIO pio, const pio_program_t *program)
+{
+  struct PIO_STATE *state = &pio_state[pio_get_index(pio)];
+  uint32_t mask = (1u << program->length) - 1;
+  for (int offset = PIO_INSTR_MEM_SIZE - program->length; offset >= 0; offset--) {
+    if ((state->used_instr & (mask << offset)) != 0) continue;
+    for (uint i = 0; i < program->length; i++) {
+      uint16_t instr = program->instructions[i];
+      state->instr_mem[offset + i] = ((instr >> 13) == 0) ? instr + offset : instr;
+    }
+    state->used_instr |= mask << offset;
+    return offset;
+  }
+  fprintf(stderr, "host: no space for a PIO program of %d instructions\n", program->length);
+  abort();
+}
+
+void pio_gpio_init(PIO pio, uint pin)
+{
+  (void) pio;
+  (void) pin;
+}
+
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out)
+{
+  (void) pio;
+  (void) sm;
+  (void) pin_base;
+  (void) pin_count;
+  (void) is_out;
+}
+
+int pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config)
+{
+  struct PIO_SM *s = get_sm(pio, sm);
+  memset(s, 0, sizeof(*s));
+  s->cfg = *config;
+  s->pc = initial_pc;
+  s->osr_count = 32;    // empty
+  return 0;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+  get_sm(pio, sm)->enabled = enabled;
+}
+
+void pio_set_sm_mask_enabled(PIO pio, uint32_t mask, bool enabled)
+{
+  for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++) {
+    if (mask & (1u << sm)) pio_sm_set_enabled(pio, sm, enabled);
+  }
+}
+
+void pio_enable_sm_mask_in_sync(PIO pio, uint32_t mask)
+{
+  pio_set_sm_mask_enabled(pio, mask, true);
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data)
+{
+  struct PIO_SM *s = get_sm(pio, sm);
+  if (s->tx_len < tx_fifo_depth(s)) s->tx_fifo[s->tx_len++] = data;
+}
+
+void pio_sm_exec(PIO pio, uint sm, uint instr)
+{
+  struct PIO_SM *s = get_sm(pio, sm);
+  int jump = -1;
+  exec_instr(pio, sm, instr, &jump);
+  if (jump >= 0) s->pc = jump;
+  update_irq_flags(&pio_state[pio_get_index(pio)]);
+}
+
+static bool get_pio_fifo(uintptr_t addr, bool tx, PIO *pio, uint *sm)
+{
+  PIO pios[2] = { pio0, pio1 };
+  for (int i = 0; i < 2; i++) {
+    uintptr_t base = (tx) ? (uintptr_t) &pios[i]->txf[0] : (uintptr_t) &pios[i]->rxf[0];
+    if (addr >= base && addr < base + NUM_PIO_STATE_MACHINES * sizeof(io_rw_32)) {
+      *pio = pios[i];
+      *sm  = (addr - base) / sizeof(io_rw_32);
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool get_pio_tx_fifo(uintptr_t addr, PIO *pio, uint *sm)
+{
+  return get_pio_fifo(addr, true, pio, sm);
+}
+
+static bool get_pio_rx_fifo(uintptr_t addr, PIO *pio, uint *sm)
+{
+  return get_pio_fifo(addr, false, pio, sm);
+}
+
+// Number of elements a DREQ of an emulated state machine lets through
+static uint32_t pio_dreq_count(uint treq)
+{
+  PIO pio = (treq >= DREQ_PIO1_TX0) ? pio1 : pio0;
+  struct PIO_SM *s = get_sm(pio, treq % NUM_PIO_STATE_MACHINES);
+  bool tx = (treq - ((treq >= DREQ_PIO1_TX0) ? DREQ_PIO1_TX0 : DREQ_PIO0_TX0)) < NUM_PIO_STATE_MACHINES;
+  return (tx) ? tx_fifo_depth(s) - s->tx_len : s->rx_len;
+}
+
+static void dma_pio_service(void);
+
+// The DMA is much faster than the state machines, so it runs after
+// every cycle
+bool host_pio_step(void)
+{
+  bool enabled = false;
+  for (uint p = 0; p < 2; p++) {
+    PIO pio = (p == 0) ? pio0 : pio1;
+    for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; sm++) {
+      if (pio_state[p].sm[sm].enabled) {
+        step_sm(pio, sm);
+        enabled = true;
+      }
+    }
+    update_irq_flags(&pio_state[p]);
+  }
+  pio_cycles++;
+  dma_pio_service();
+  return enabled;
+}
+
+uint64_t host_pio_cycles(void)
+{
+  return pio_cycles;
+}
+
+// === DMA ==========================================================
+
+static void dma_dispatch(void);
+
+static bool is_dma_reg(uintptr_t addr)
+{
+  return (addr >= (uintptr_t) &dma_hw->ch[0] &&
+          addr <  (uintptr_t) &dma_hw->ch[NUM_DMA_CHANNELS]);
+}
+
+static uint get_treq(uint channel)
+{
+  return (dma_hw->ch[channel].ctrl_trig & DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS) >> DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB;
+}
+
+static bool is_paced(uint channel)
+{
+  return get_treq(channel) != DREQ_FORCE;
+}
+
+// transfers paced by emulated state machines run as far as their FIFOs allow
+static bool is_pio_paced(uint channel)
+{
+  return pio_emulated && get_treq(channel) < DREQ_PIO1_TX0 + 2*NUM_PIO_STATE_MACHINES;
+}
+
+// unpaced transfers to memory run a chunk per host_dma_step() if
+// host_dma_set_memory_chunk() was called
+static bool is_chunked(uint channel)
+{
+  PIO pio;
+  uint sm;
+  uintptr_t dst = dma_hw->ch[channel].write_addr;
+  return (dma_memory_chunk != 0 && ! is_paced(channel) &&
+          ! is_dma_reg(dst) && ! get_pio_tx_fifo(dst, &pio, &sm));
+}
+
+static void dma_trigger(uint channel)
+{
+  if (dma_hw->ch[channel].ctrl_trig & DMA_CH0_CTRL_TRIG_EN_BITS) {
+    dma_pending |= 1u << channel;
+  }
+}
+
+static void write_dma_reg(uintptr_t addr, uintptr_t val)
+{
+  uint reg = (addr - (uintptr_t) &dma_hw->ch[0]) / sizeof(io_rw_32);
+  uint channel = reg / 16;
+  dma_channel_hw_t *hw = &dma_hw->ch[channel];
+
+  switch (reg % 16) {
+  case 0: case 5: case 10: case 15: hw->read_addr = val; break;
+  case 1: case 6: case 11: case 13: hw->write_addr = val; break;
+  case 2: case 7: case 9:  case 14: hw->transfer_count = val; break;
+  case 3: case 4: case 8:  case 12: hw->ctrl_trig = val; break;
+  }
+
+  // a write of 0 to an alias trigger register is a null trigger
+  switch (reg % 16) {
+  case 3: dma_trigger(channel); break;
+  case 7: case 11: case 15: if (val != 0) dma_trigger(channel); break;
+  }
+}
+
+static uintptr_t read_elem(uintptr_t addr, size_t size)
+{
+  PIO pio;
+  uint sm;
+
+  if (pio_emulated && get_pio_rx_fifo(addr, &pio, &sm)) {
+    struct PIO_SM *s = get_sm(pio, sm);
+    uint32_t data = s->rx_fifo[0];
+    if (s->rx_len > 0) memmove(&s->rx_fifo[0], &s->rx_fifo[1], --s->rx_len * sizeof(uint32_t));
+    return data;
+  }
+  switch (size) {
+  case 1: return *(volatile uint8_t *) addr;
+  case 2: return *(volatile uint16_t *) addr;
+  case 4: return *(volatile uint32_t *) addr;
+  default: return *(volatile uintptr_t *) addr;
+  }
+}
+
+static void write_elem(uintptr_t addr, uintptr_t val, size_t size)
+{
+  PIO pio;
+  uint sm;
+
+  if (is_dma_reg(addr)) {
+    dma_reg_writes++;
+    write_dma_reg(addr, val);
+  } else if (get_pio_tx_fifo(addr, &pio, &sm)) {
+    dma_pio_words++;
+    if (pio_tx_func) pio_tx_func(pio, sm, (uint32_t) val);
+    struct PIO_SM *s = get_sm(pio, sm);
+    if (pio_emulated && s->tx_len < tx_fifo_depth(s)) s->tx_fifo[s->tx_len++] = (uint32_t) val;
+  } else {
+    switch (size) {
+    case 1: *(volatile uint8_t *) addr = val; break;
+    case 2: *(volatile uint16_t *) addr = val; break;
+    case 4: *(volatile uint32_t *) addr = val; break;
+    default: *(volatile uintptr_t *) addr = val; break;
+    }
+  }
+}
+
+static uintptr_t advance(uintptr_t addr, size_t size, size_t ring_bytes)
+{
+  if (ring_bytes == 0) return addr + size;
+  return (addr & ~(uintptr_t)(ring_bytes-1)) | ((addr + size) & (ring_bytes-1));
+}
+
+static void dma_run(uint channel)
+{
+  dma_channel_hw_t *hw = &dma_hw->ch[channel];
+  uint32_t ctrl  = hw->ctrl_trig;
+  uintptr_t src  = hw->read_addr;
+  uintptr_t dst  = hw->write_addr;
+  uint32_t count = (dma_remaining[channel] != 0) ? dma_remaining[channel] : hw->transfer_count;
+
+  // register destinations (and their sources) use pointer-sized elements
+  size_t scale = 1;
+  size_t size = 1u << ((ctrl & DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS) >> DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB);
+  if (is_dma_reg(dst)) {
+    scale = sizeof(io_rw_32) / size;
+    size = sizeof(io_rw_32);
+  }
+  uint ring_bits = (ctrl & DMA_CH0_CTRL_TRIG_RING_SIZE_BITS) >> DMA_CH0_CTRL_TRIG_RING_SIZE_LSB;
+  size_t ring_bytes = (ring_bits == 0) ? 0 : ((size_t)1 << ring_bits) * scale;
+  bool ring_write = (ctrl & DMA_CH0_CTRL_TRIG_RING_SEL_BITS) != 0;
+
+  uint32_t run = (is_chunked(channel) && count > dma_memory_chunk) ? dma_memory_chunk : count;
+  if (is_pio_paced(channel)) {
+    uint32_t ready = pio_dreq_count(get_treq(channel));
+    if (ready == 0) return;
+    if (run > ready) run = ready;
+  }
+
+  PIO pio;
+  uint sm;
+  if (pio_read_func && dma_remaining[channel] == 0 && get_pio_tx_fifo(dst, &pio, &sm)) {
+    pio_read_func(pio, sm, (const void *) src, count);
+  }
+  dma_pending &= ~(1u << channel);
+  for (uint32_t i = 0; i < run; i++) {
+    write_elem(dst, read_elem(src, size), size);
+    if (ctrl & DMA_CH0_CTRL_TRIG_INCR_READ_BITS)  src = advance(src, size, ring_write ? 0 : ring_bytes);
+    if (ctrl & DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS) dst = advance(dst, size, ring_write ? ring_bytes : 0);
+  }
+
+  // the transfer may have reprogrammed other channels, but never
+  // itself; the transfer count is reloaded on the next trigger
+  hw->read_addr = src;
+  hw->write_addr = dst;
+  if (run < count) {
+    dma_remaining[channel] = count - run;
+    dma_pending |= 1u << channel;
+    return;
+  }
+  dma_remaining[channel] = 0;
+
+  uint chain_to = (ctrl & DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) >> DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB;
+  if (chain_to != channel) {
+    dma_trigger(chain_to);
+  }
+  if ((ctrl & DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS) == 0) {
+    dma_hw->intr |= 1u << channel;
+    dma_irq_pending |= 1u << channel;
+  }
+}
+
+static void call_irq_handler(uint num)
+{
+  irq_handlers[num]();
+
+  // handlers clear TXSTALL flags by writing 1s to them, which a
+  // plain variable can't emulate: they're seen by one interrupt
+  pio0->fdebug &= ~(uintptr_t) PIO_FDEBUG_TXSTALL_BITS;
+  pio1->fdebug &= ~(uintptr_t) PIO_FDEBUG_TXSTALL_BITS;
+}
+
+static void dma_raise_irqs(void)
+{
+  while (dma_irq_pending != 0) {
+    uint32_t pending = dma_irq_pending;
+    dma_irq_pending = 0;
+    if ((pending & dma_hw->inte0) && (irq_enabled & (1u << DMA_IRQ_0)) && irq_handlers[DMA_IRQ_0]) {
+      dma_hw->ints0 = pending & dma_hw->inte0;
+      call_irq_handler(DMA_IRQ_0);
+    }
+    if ((pending & dma_hw->inte1) && (irq_enabled & (1u << DMA_IRQ_1)) && irq_handlers[DMA_IRQ_1]) {
+      dma_hw->ints1 = pending & dma_hw->inte1;
+      call_irq_handler(DMA_IRQ_1);
+    }
+    dma_hw->intr &= ~pending;
+    dma_dispatch();
+  }
+}
+
+// run all unpaced transfers that are ready, then deliver their IRQs
+static void dma_dispatch(void)
+{
+  if (dma_dispatching) return;
+  dma_dispatching = true;
+  bool ran;
+  do {
+    ran = false;
+    for (uint channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
+      if ((dma_pending & (1u << channel)) && ! is_paced(channel) && ! is_chunked(channel)) {
+        dma_run(channel);
+        ran = true;
+      }
+    }
+  } while (ran);
+  dma_dispatching = false;
+  dma_raise_irqs();
+}
+
+static void dma_pio_service(void)
+{
+  bool ran;
+  do {
+    ran = false;
+    for (uint channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
+      if ((dma_pending & (1u << channel)) && is_pio_paced(channel) && pio_dreq_count(get_treq(channel)) > 0) {
+        dma_run(channel);
+        dma_dispatch();
+        ran = true;
+      }
+    }
+  } while (ran);
+}
+
+static bool dma_step(void)
+{
+  if (pio_emulated) return host_pio_step();
+  dma_dispatch();
+
+  // transfers to memory make progress along with the paced ones
+  bool ran = false;
+  for (uint channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
+    if ((dma_pending & (1u << channel)) && is_chunked(channel)) {
+      dma_run(channel);
+      ran = true;
+    }
+  }
+  if (ran) dma_dispatch();
+
+  for (uint channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
+    if ((dma_pending & (1u << channel)) && ! is_chunked(channel)) {
+      dma_run(channel);
+      dma_dispatch();
+      return true;
+    }
+  }
+  return ran;
+}
+
+// core0 and core1 (a second thread) both step the DMA from
+// tight_loop_contents(), so steps are serialized.  The mutex is
+// recursive because the IRQ handlers run inside a step.
+static pthread_mutex_t dma_step_mutex;
+static pthread_once_t dma_step_once = PTHREAD_ONCE_INIT;
+
+static void init_dma_step_mutex(void)
+{
+  pthread_mutexattr_t attr;
+  pthread_mutexattr_init(&attr);
+  pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&dma_step_mutex, &attr);
+  pthread_mutexattr_destroy(&attr);
+}
+
+bool host_dma_step(void)
+{
+  pthread_once(&dma_step_once, init_dma_step_mutex);
+  pthread_mutex_lock(&dma_step_mutex);
+  bool ran = dma_step();
+  pthread_mutex_unlock(&dma_step_mutex);
+  return ran;
+}
+
+void host_dma_set_memory_chunk(uint32_t num_elements)
+{
+  dma_memory_chunk = num_elements;
+}
+
+uint64_t host_dma_pio_words(void)
+{
+  return dma_pio_words;
+}
+
+uint64_t host_dma_reg_writes(void)
+{
+  return dma_reg_writes;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+  for (uint channel = 0; channel < NUM_DMA_CHANNELS; channel++) {
+    if ((dma_claimed & (1u << channel)) == 0) {
+      dma_claimed |= 1u << channel;
+      return channel;
+    }
+  }
+  if (required) {
+    fprintf(stderr, "host: no free DMA channel\n");
+    abort();
+  }
+  return -1;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+  dma_claimed &= ~(1u << channel);
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config,
+                           volatile void *write_addr, const volatile void *read_addr,
+                           uint transfer_count, bool trigger)
+{
+  dma_channel_hw_t *hw = &dma_hw->ch[channel];
+  hw->read_addr = (uintptr_t) read_addr;
+  hw->write_addr = (uintptr_t) write_addr;
+  hw->transfer_count = transfer_count;
+  hw->ctrl_trig = config->ctrl;
+  if (trigger) dma_channel_start(channel);
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger)
+{
+  dma_hw->ch[channel].read_addr = (uintptr_t) read_addr;
+  if (trigger) dma_channel_start(channel);
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger)
+{
+  dma_hw->ch[channel].write_addr = (uintptr_t) write_addr;
+  if (trigger) dma_channel_start(channel);
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger)
+{
+  dma_hw->ch[channel].transfer_count = trans_count;
+  if (trigger) dma_channel_start(channel);
+}
+
+void dma_channel_start(uint channel)
+{
+  dma_trigger(channel);
+  dma_dispatch();
+}
+
+void dma_channel_abort(uint channel)
+{
+  dma_pending &= ~(1u << channel);
+  dma_remaining[channel] = 0;
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+  return (dma_pending & (1u << channel)) != 0;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel)
+{
+  while (dma_channel_is_busy(channel)) {
+    if (! host_dma_step()) break;
+  }
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+  if (enabled) {
+    dma_hw->inte0 |= 1u << channel;
+  } else {
+    dma_hw->inte0 &= ~(1u << channel);
+  }
+}
+
+void dma_channel_set_irq1_enabled(uint channel, bool enabled)
+{
+  if (enabled) {
+    dma_hw->inte1 |= 1u << channel;
+  } else {
+    dma_hw->inte1 &= ~(1u << channel);
+  }
+}
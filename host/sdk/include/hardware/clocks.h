@@ -0,0 +1,23 @@
+#ifndef HARDWARE_CLOCKS_H_FILE
+#define HARDWARE_CLOCKS_H_FILE
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define CLOCKS_FC0_SRC_VALUE_CLK_SYS 0x09
+
+enum clock_index {
+  clk_sys = 5,
+};
+
+uint32_t frequency_count_khz(uint src);
+uint32_t clock_get_hz(enum clock_index clk_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HARDWARE_CLOCKS_H_FILE */
@@ -0,0 +1,151 @@
+#ifndef HARDWARE_DMA_H_FILE
+#define HARDWARE_DMA_H_FILE
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUM_DMA_CHANNELS 12
+
+// CTRL_TRIG register fields (same layout as the RP2040)
+#define DMA_CH0_CTRL_TRIG_EN_BITS             0x00000001
+#define DMA_CH0_CTRL_TRIG_HIGH_PRIORITY_BITS  0x00000002
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB       2
+#define DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS      0x0000000c
+#define DMA_CH0_CTRL_TRIG_INCR_READ_BITS      0x00000010
+#define DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS     0x00000020
+#define DMA_CH0_CTRL_TRIG_RING_SIZE_LSB       6
+#define DMA_CH0_CTRL_TRIG_RING_SIZE_BITS      0x000003c0
+#define DMA_CH0_CTRL_TRIG_RING_SEL_BITS       0x00000400
+#define DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB        11
+#define DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS       0x00007800
+#define DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB        15
+#define DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS       0x001f8000
+#define DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS      0x00200000
+#define DMA_CH0_CTRL_TRIG_BSWAP_BITS          0x00400000
+#define DMA_CH0_CTRL_TRIG_SNIFF_EN_BITS       0x00800000
+#define DMA_CH0_CTRL_TRIG_BUSY_BITS           0x01000000
+#define DMA_CH0_CTRL_TRIG_AHB_ERROR_BITS      0x80000000
+
+#define DREQ_PIO0_TX0  0
+#define DREQ_PIO1_TX0  8
+#define DREQ_FORCE     0x3f
+
+enum dma_channel_transfer_size {
+  DMA_SIZE_8  = 0,
+  DMA_SIZE_16 = 1,
+  DMA_SIZE_32 = 2,
+};
+
+typedef struct {
+  io_rw_32 read_addr;
+  io_rw_32 write_addr;
+  io_rw_32 transfer_count;
+  io_rw_32 ctrl_trig;
+  io_rw_32 al1_ctrl;
+  io_rw_32 al1_read_addr;
+  io_rw_32 al1_write_addr;
+  io_rw_32 al1_transfer_count_trig;
+  io_rw_32 al2_ctrl;
+  io_rw_32 al2_transfer_count;
+  io_rw_32 al2_read_addr;
+  io_rw_32 al2_write_addr_trig;
+  io_rw_32 al3_ctrl;
+  io_rw_32 al3_write_addr;
+  io_rw_32 al3_transfer_count;
+  io_rw_32 al3_read_addr_trig;
+} dma_channel_hw_t;
+
+typedef struct {
+  dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+  io_rw_32 intr;
+  io_rw_32 inte0;
+  io_rw_32 intf0;
+  io_rw_32 ints0;
+  io_rw_32 inte1;
+  io_rw_32 intf1;
+  io_rw_32 ints1;
+} dma_hw_t;
+
+extern dma_hw_t host_dma_hw;
+#define dma_hw (&host_dma_hw)
+
+typedef struct {
+  uint32_t ctrl;
+} dma_channel_config;
+
+int dma_claim_unused_channel(bool required);
+void dma_channel_unclaim(uint channel);
+void dma_channel_configure(uint channel, const dma_channel_config *config,
+                           volatile void *write_addr, const volatile void *read_addr,
+                           uint transfer_count, bool trigger);
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger);
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr, bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger);
+void dma_channel_start(uint channel);
+void dma_channel_abort(uint channel);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_wait_for_finish_blocking(uint channel);
+void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+void dma_channel_set_irq1_enabled(uint channel, bool enabled);
+
+static inline dma_channel_config dma_channel_get_default_config(uint channel)
+{
+  dma_channel_config c;
+  c.ctrl = (DMA_CH0_CTRL_TRIG_INCR_READ_BITS                             |
+            (DREQ_FORCE << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)               |
+            (channel << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)                  |
+            (((uint) DMA_SIZE_32) << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB)    |
+            DMA_CH0_CTRL_TRIG_EN_BITS);
+  return c;
+}
+
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+  c->ctrl = incr ? (c->ctrl | DMA_CH0_CTRL_TRIG_INCR_READ_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_INCR_READ_BITS);
+}
+
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+  c->ctrl = incr ? (c->ctrl | DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_INCR_WRITE_BITS);
+}
+
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+  c->ctrl = (c->ctrl & ~DMA_CH0_CTRL_TRIG_TREQ_SEL_BITS) | (dreq << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB);
+}
+
+static inline void channel_config_set_chain_to(dma_channel_config *c, uint chain_to)
+{
+  c->ctrl = (c->ctrl & ~DMA_CH0_CTRL_TRIG_CHAIN_TO_BITS) | (chain_to << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB);
+}
+
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+  c->ctrl = (c->ctrl & ~DMA_CH0_CTRL_TRIG_DATA_SIZE_BITS) | (((uint) size) << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB);
+}
+
+static inline void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits)
+{
+  c->ctrl = ((c->ctrl & ~(DMA_CH0_CTRL_TRIG_RING_SIZE_BITS | DMA_CH0_CTRL_TRIG_RING_SEL_BITS)) |
+             (size_bits << DMA_CH0_CTRL_TRIG_RING_SIZE_LSB) |
+             (write ? DMA_CH0_CTRL_TRIG_RING_SEL_BITS : 0));
+}
+
+static inline void channel_config_set_irq_quiet(dma_channel_config *c, bool irq_quiet)
+{
+  c->ctrl = irq_quiet ? (c->ctrl | DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS);
+}
+
+static inline void channel_config_set_enable(dma_channel_config *c, bool enable)
+{
+  c->ctrl = enable ? (c->ctrl | DMA_CH0_CTRL_TRIG_EN_BITS) : (c->ctrl & ~DMA_CH0_CTRL_TRIG_EN_BITS);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HARDWARE_DMA_H_FILE */
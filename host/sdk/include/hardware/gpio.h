@@ -0,0 +1,23 @@
+#ifndef HARDWARE_GPIO_H_FILE
+#define HARDWARE_GPIO_H_FILE
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum gpio_override {
+  GPIO_OVERRIDE_NORMAL = 0,
+  GPIO_OVERRIDE_INVERT = 1,
+  GPIO_OVERRIDE_LOW    = 2,
+  GPIO_OVERRIDE_HIGH   = 3,
+};
+
+void gpio_set_outover(uint gpio, uint value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HARDWARE_GPIO_H_FILE */
@@ -0,0 +1,23 @@
+#ifndef HARDWARE_IRQ_H_FILE
+#define HARDWARE_IRQ_H_FILE
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define DMA_IRQ_0 11
+#define DMA_IRQ_1 12
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_set_priority(uint num, uint8_t hardware_priority);
+void irq_set_enabled(uint num, bool enabled);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HARDWARE_IRQ_H_FILE */
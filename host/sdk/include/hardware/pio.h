@@ -0,0 +1,189 @@
+#ifndef HARDWARE_PIO_H_FILE
+#define HARDWARE_PIO_H_FILE
+
+#include "pico.h"
+#include "hardware/dma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUM_PIO_STATE_MACHINES 4
+
+#define PIO_FDEBUG_TXSTALL_LSB  24
+#define PIO_FDEBUG_TXSTALL_BITS 0x0f000000
+#define PIO_FDEBUG_TXOVER_LSB   16
+#define PIO_FDEBUG_TXOVER_BITS  0x000f0000
+
+typedef struct {
+  io_rw_32 ctrl;
+  io_ro_32 fstat;
+  io_rw_32 fdebug;
+  io_ro_32 flevel;
+  io_wo_32 txf[NUM_PIO_STATE_MACHINES];
+  io_ro_32 rxf[NUM_PIO_STATE_MACHINES];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t host_pio0;
+extern pio_hw_t host_pio1;
+#define pio0 (&host_pio0)
+#define pio1 (&host_pio1)
+
+enum pio_fifo_join {
+  PIO_FIFO_JOIN_NONE = 0,
+  PIO_FIFO_JOIN_TX   = 1,
+  PIO_FIFO_JOIN_RX   = 2,
+};
+
+typedef struct pio_program {
+  const uint16_t *instructions;
+  uint8_t length;
+  int8_t origin;
+} pio_program_t;
+
+typedef struct {
+  uint wrap_target;
+  uint wrap;
+  uint out_base;
+  uint out_count;
+  uint set_base;
+  uint set_count;
+  uint sideset_base;
+  uint sideset_bits;
+  bool sideset_optional;
+  bool sideset_pindirs;
+  bool out_shift_right;
+  bool autopull;
+  uint pull_threshold;
+  bool in_shift_right;
+  bool autopush;
+  uint push_threshold;
+  enum pio_fifo_join join;
+  float clkdiv;
+} pio_sm_config;
+
+static inline uint pio_get_index(PIO pio)
+{
+  return pio == pio1;
+}
+
+static inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{
+  return (pio == pio1 ? DREQ_PIO1_TX0 : DREQ_PIO0_TX0) + sm + (is_tx ? 0 : NUM_PIO_STATE_MACHINES);
+}
+
+static inline pio_sm_config pio_get_default_sm_config(void)
+{
+  pio_sm_config c = { 0 };
+  c.wrap = 31;
+  c.out_shift_right = true;
+  c.pull_threshold = 32;
+  c.in_shift_right = true;
+  c.push_threshold = 32;
+  c.clkdiv = 1.f;
+  return c;
+}
+
+static inline void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap)
+{
+  c->wrap_target = wrap_target;
+  c->wrap = wrap;
+}
+
+static inline void sm_config_set_out_pins(pio_sm_config *c, uint out_base, uint out_count)
+{
+  c->out_base = out_base;
+  c->out_count = out_count;
+}
+
+static inline void sm_config_set_set_pins(pio_sm_config *c, uint set_base, uint set_count)
+{
+  c->set_base = set_base;
+  c->set_count = set_count;
+}
+
+static inline void sm_config_set_sideset(pio_sm_config *c, uint bit_count, bool optional, bool pindirs)
+{
+  c->sideset_bits = bit_count;
+  c->sideset_optional = optional;
+  c->sideset_pindirs = pindirs;
+}
+
+static inline void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base)
+{
+  c->sideset_base = sideset_base;
+}
+
+static inline void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold)
+{
+  c->out_shift_right = shift_right;
+  c->autopull = autopull;
+  c->pull_threshold = pull_threshold;
+}
+
+static inline void sm_config_set_in_shift(pio_sm_config *c, bool shift_right, bool autopush, uint push_threshold)
+{
+  c->in_shift_right = shift_right;
+  c->autopush = autopush;
+  c->push_threshold = push_threshold;
+}
+
+static inline void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join)
+{
+  c->join = join;
+}
+
+static inline void sm_config_set_clkdiv(pio_sm_config *c, float div)
+{
+  c->clkdiv = div;
+}
+
+// instruction encoding (hardware/pio_instructions.h)
+enum pio_src_dest {
+  pio_pins    = 0,
+  pio_x       = 1,
+  pio_y       = 2,
+  pio_null    = 3,
+  pio_pindirs = 4,
+  pio_isr     = 6,
+  pio_osr     = 7,
+};
+
+static inline uint pio_encode_out(enum pio_src_dest dest, uint count)
+{
+  return 0x6000 | (dest << 5) | (count & 0x1f);
+}
+
+static inline uint pio_encode_pull(bool if_empty, bool block)
+{
+  return 0x8080 | (if_empty << 6) | (block << 5);
+}
+
+static inline uint pio_encode_mov(enum pio_src_dest dest, enum pio_src_dest src)
+{
+  return 0xa000 | (dest << 5) | src;
+}
+
+static inline uint pio_encode_set(enum pio_src_dest dest, uint value)
+{
+  return 0xe000 | (dest << 5) | (value & 0x1f);
+}
+
+int pio_claim_unused_sm(PIO pio, bool required);
+uint pio_add_program(PIO pio, const pio_program_t *program);
+void pio_gpio_init(PIO pio, uint pin);
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out);
+int pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+void pio_set_sm_mask_enabled(PIO pio, uint32_t mask, bool enabled);
+void pio_enable_sm_mask_in_sync(PIO pio, uint32_t mask);
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data);
+void pio_sm_exec(PIO pio, uint sm, uint instr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HARDWARE_PIO_H_FILE */
@@ -0,0 +1,19 @@
+#ifndef HARDWARE_STRUCTS_BUS_CTRL_H_FILE
+#define HARDWARE_STRUCTS_BUS_CTRL_H_FILE
+
+#include "pico.h"
+
+#define BUSCTRL_BUS_PRIORITY_PROC0_BITS  0x00000001
+#define BUSCTRL_BUS_PRIORITY_PROC1_BITS  0x00000010
+#define BUSCTRL_BUS_PRIORITY_DMA_R_BITS  0x00000100
+#define BUSCTRL_BUS_PRIORITY_DMA_W_BITS  0x00001000
+
+typedef struct {
+  io_rw_32 priority;
+  io_ro_32 priority_ack;
+} bus_ctrl_hw_t;
+
+extern bus_ctrl_hw_t host_bus_ctrl_hw;
+#define bus_ctrl_hw (&host_bus_ctrl_hw)
+
+#endif /* HARDWARE_STRUCTS_BUS_CTRL_H_FILE */
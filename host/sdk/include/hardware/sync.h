@@ -0,0 +1,61 @@
+#ifndef HARDWARE_SYNC_H_FILE
+#define HARDWARE_SYNC_H_FILE
+
+#include <sched.h>
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NUM_SPIN_LOCKS 32
+
+typedef volatile uint32_t spin_lock_t;
+
+spin_lock_t *spin_lock_instance(uint lock_num);
+int spin_lock_claim_unused(bool required);
+
+static inline void __dmb(void)
+{
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+}
+
+// there are no events between threads, so waiting just yields
+static inline void __sev(void)
+{
+}
+
+static inline void __wfe(void)
+{
+  sched_yield();
+}
+
+static inline uint32_t save_and_disable_interrupts(void)
+{
+  return 0;
+}
+
+static inline void restore_interrupts(uint32_t status)
+{
+  (void) status;
+}
+
+static inline uint32_t spin_lock_blocking(spin_lock_t *lock)
+{
+  while (__atomic_exchange_n(lock, 1, __ATOMIC_ACQUIRE) != 0) {
+  }
+  return save_and_disable_interrupts();
+}
+
+static inline void spin_unlock(spin_lock_t *lock, uint32_t saved_irq)
+{
+  __atomic_store_n(lock, 0, __ATOMIC_RELEASE);
+  restore_interrupts(saved_irq);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HARDWARE_SYNC_H_FILE */
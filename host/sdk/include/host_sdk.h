@@ -0,0 +1,66 @@
+#ifndef HOST_SDK_H_FILE
+#define HOST_SDK_H_FILE
+
+#include "pico.h"
+#include "hardware/pio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Called for every word a DMA channel writes to a PIO TX FIFO.
+typedef void (*host_pio_tx_func)(PIO pio, uint sm, uint32_t data);
+
+void host_pio_set_tx_func(host_pio_tx_func func);
+
+// Called at the start of every DMA transfer to a PIO TX FIFO, with the
+// address it reads from and the number of words.
+typedef void (*host_pio_read_func)(PIO pio, uint sm, const void *src, uint32_t count);
+
+void host_pio_set_read_func(host_pio_read_func func);
+
+// Sets the TXSTALL flag of a state machine, as if it had run out of
+// data (the host never does).  It's seen by the next DMA interrupt.
+void host_pio_set_tx_stall(PIO pio, uint sm);
+
+// Runs the programs loaded in the state machines (off by default).
+// DMA transfers to and from their FIFOs are then paced by the FIFO
+// levels, and only make progress when the state machines run.
+void host_pio_set_emulated(bool emulated);
+
+// Runs one clock cycle of every enabled state machine, followed by
+// the DMA transfers it makes ready.  Returns false if no state machine
+// is enabled.
+bool host_pio_step(void);
+
+// Number of cycles run by host_pio_step() so far.
+uint64_t host_pio_cycles(void);
+
+// Levels of GPIOs 0-31 driven by the emulated state machines,
+// including the inversion set with gpio_set_outover().
+uint32_t host_gpio_get_all(void);
+
+// Executes the next pending DMA transfer paced by a peripheral
+// (i.e., one that doesn't use DREQ_FORCE), together with everything
+// it chains to and the IRQ handlers it raises.  Returns false if no
+// such transfer is pending.  With emulated state machines, calls
+// host_pio_step() instead.  Calls from both cores are serialized.
+bool host_dma_step(void);
+
+// Makes transfers to memory paced by DREQ_FORCE run num_elements at a
+// time, one chunk each time host_dma_step() is called, instead of all
+// at once when triggered (0, the default).
+void host_dma_set_memory_chunk(uint32_t num_elements);
+
+// Number of words written by the DMA to PIO TX FIFOs so far.
+uint64_t host_dma_pio_words(void);
+
+// Number of words written by the DMA to DMA channel registers so far
+// (i.e., the work done loading control blocks).
+uint64_t host_dma_reg_writes(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HOST_SDK_H_FILE */
@@ -0,0 +1,33 @@
+/**
+ * pico.h (host)
+ *
+ * Minimal stand-in for the Pico SDK base header, used to build the
+ * VGA code on a desktop machine.  Only what the demo code uses is
+ * provided.
+ */
+
+#ifndef PICO_H_FILE
+#define PICO_H_FILE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+// Hardware registers are pointer-sized on the host, so that registers
+// holding addresses (like DMA read/write addresses) can store host
+// pointers.  On the RP2040 both are 32 bits.
+typedef volatile uintptr_t io_rw_32;
+typedef volatile uintptr_t io_ro_32;
+typedef volatile uintptr_t io_wo_32;
+
+#define __isr
+#define __time_critical_func(f)  f
+#define __not_in_flash_func(f)   f
+
+#ifndef count_of
+#define count_of(a) (sizeof(a)/sizeof((a)[0]))
+#endif
+
+#endif /* PICO_H_FILE */
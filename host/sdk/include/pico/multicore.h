@@ -0,0 +1,17 @@
+#ifndef PICO_MULTICORE_H_FILE
+#define PICO_MULTICORE_H_FILE
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Runs entry in a new thread standing in for core1.
+void multicore_launch_core1(void (*entry)(void));
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PICO_MULTICORE_H_FILE */
@@ -0,0 +1,18 @@
+#ifndef PICO_PLATFORM_H_FILE
+#define PICO_PLATFORM_H_FILE
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Returns 1 in the thread started by multicore_launch_core1(), 0
+// elsewhere.
+uint get_core_num(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PICO_PLATFORM_H_FILE */
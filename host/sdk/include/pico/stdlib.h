@@ -0,0 +1,34 @@
+#ifndef PICO_STDLIB_H_FILE
+#define PICO_STDLIB_H_FILE
+
+#include <stdio.h>
+
+#include "pico.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef uint64_t absolute_time_t;
+
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+absolute_time_t get_absolute_time(void);
+void sleep_ms(uint32_t ms);
+void tight_loop_contents(void);
+
+static inline uint32_t to_ms_since_boot(absolute_time_t t)
+{
+  return (uint32_t) (t / 1000);
+}
+
+static inline bool stdio_init_all(void)
+{
+  return true;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PICO_STDLIB_H_FILE */
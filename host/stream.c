@@ -0,0 +1,70 @@
+/**
+ * stream.c
+ *
+ * The byte stream sent to the monitor, as captured by the host
+ * simulations: from the words the DMA writes to the PIO, or from the
+ * output pins of the emulated state machines.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "stream.h"
+
+uint8_t *stream;
+size_t stream_len;
+uint stream_sm;
+
+static size_t stream_cap;
+
+void stream_add(uint8_t b)
+{
+  if (stream_len + 1 > stream_cap) {
+    stream_cap = (stream_cap == 0) ? 65536 : 2*stream_cap;
+    stream = realloc(stream, stream_cap);
+    if (! stream) {
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+  }
+  stream[stream_len++] = b;
+}
+
+static void pio_tx(PIO pio, uint sm, uint32_t data)
+{
+  (void) pio;
+  stream_sm = sm;
+  for (int i = 0; i < 4; i++) {
+    stream_add((data >> (8*i)) & 0xff);
+  }
+}
+
+void stream_capture_dma(void)
+{
+  host_pio_set_tx_func(pio_tx);
+}
+
+int stream_run_dma(size_t len)
+{
+  while (stream_len < len) {
+    if (! host_dma_step()) {
+      printf("DMA chain stopped\n");
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Lines start on even cycles (counting from when the state machines
+// were enabled), so the pins are sampled right after them
+int stream_run_pins(size_t len, uint pin_base)
+{
+  while (stream_len < len) {
+    if (! host_pio_step()) {
+      printf("state machines stopped\n");
+      return 1;
+    }
+    if (host_pio_cycles() % 2 == 1) stream_add((host_gpio_get_all() >> pin_base) & 0xff);
+  }
+  return 0;
+}
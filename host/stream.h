@@ -0,0 +1,29 @@
+#ifndef STREAM_H_FILE
+#define STREAM_H_FILE
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "host_sdk.h"
+
+// Bytes sent to the monitor, captured by the host simulations
+extern uint8_t *stream;
+extern size_t stream_len;
+extern uint stream_sm;          // state machine the DMA sent the last word to
+
+void stream_add(uint8_t b);
+
+// Adds every word the DMA writes to a PIO TX FIFO, lowest byte first
+void stream_capture_dma(void);
+
+// Runs the DMA until the stream has at least len bytes.  Returns
+// nonzero (and says why) if the DMA stops first.
+int stream_run_dma(size_t len);
+
+// Runs the emulated state machines until the stream has at least len
+// bytes, adding the 8 pins from pin_base every second cycle (once per
+// pixel, the state machines run at twice the pixel clock).  Returns
+// nonzero (and says why) if the state machines stop first.
+int stream_run_pins(size_t len, uint pin_base);
+
+#endif /* STREAM_H_FILE */
@@ -0,0 +1,160 @@
+/**
+ * text_sim.c
+ *
+ * Runs the VGA driver in text mode on the host and checks every pixel
+ * of a frame sent to the monitor against a reference that draws each
+ * cell a pixel at a time: the glyph row bit selects the foreground or
+ * background palette color from the cell's attribute, and pixels past
+ * the last column or row are black.  The font is made up of
+ * pseudo-random rows of the given size (6 pixels wide uses the fast
+ * path of two cells at a time), the text buffer has every character
+ * (including ones not in the font) and attribute, and the palette is
+ * changed after init.
+ *
+ * Usage: text_sim [font_w font_h]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_text.h"
+#include "host_sdk.h"
+
+#define FIRST_CHAR 32
+#define NUM_CHARS  96
+
+static const struct VGA_MODE *mode = &vga_mode_320x240;
+
+static struct VGA_FONT font;
+static unsigned char font_data[NUM_CHARS * 32];
+static unsigned char palette[16];
+
+static unsigned char *lines;    // ring of the last v_pixels lines sent, h_pixels bytes each
+static int num_lines;
+
+// Each line is a single block from a line buffer, with the hblank
+// unless the PIO generates it.  Blank lines can be sent in blocks of
+// the same length, but the frame ends right after its last visible
+// line, so the visible lines are the last ones in the ring.
+static void pio_read(PIO pio, uint sm, const void *src, uint32_t count)
+{
+  (void) pio;
+  (void) sm;
+#if VGA_ENABLE_PIO_SYNC
+  int line_len = mode->h_pixels;
+#else
+  int line_len = mode->h_front_porch + mode->h_sync_pulse + mode->h_back_porch + mode->h_pixels;
+#endif
+  if (count * 4 == (uint32_t) line_len) {
+    const unsigned char *pixels = (const unsigned char *) src + line_len - mode->h_pixels;
+    memcpy(&lines[(num_lines++ % mode->v_pixels) * mode->h_pixels], pixels, mode->h_pixels);
+  }
+}
+
+static void make_font(int w, int h)
+{
+  unsigned int seed = 1;
+  for (int i = 0; i < NUM_CHARS * h; i++) {
+    seed = seed * 1103515245 + 12345;
+    font_data[i] = (seed >> 16) & ((1u << w) - 1);
+  }
+  font.w = w;
+  font.h = h;
+  font.first_char = FIRST_CHAR;
+  font.num_chars = NUM_CHARS;
+  font.data = font_data;
+}
+
+static void fill_text(void)
+{
+  for (int i = 0; i < 16; i++) {
+    palette[i] = (i * 37 + 5) & 0x3f;
+    vga_text_set_palette(i, palette[i]);
+  }
+  for (int i = 0; i < vga_text.cols * vga_text.rows; i++) {
+    vga_text.chars[i] = (i * 7) & 0xff;
+    vga_text.attrs[i] = (i * 5 + i / vga_text.cols) & 0xff;
+  }
+}
+
+static unsigned char ref_pixel(int x, int y)
+{
+  int col = x / font.w;
+  int row = y / font.h;
+  if (col >= vga_text.cols || row >= vga_text.rows) return vga_screen.sync_bits;
+
+  int ch = vga_text.chars[row * vga_text.cols + col];
+  int attr = vga_text.attrs[row * vga_text.cols + col];
+  bool in_font = (ch >= font.first_char && ch < font.first_char + font.num_chars);
+  unsigned int bits = (in_font) ? font.data[font.h * (ch - font.first_char) + y % font.h] : 0;
+  int color = ((bits >> (x % font.w)) & 1) ? attr & 0xf : attr >> 4;
+  return vga_screen.sync_bits | palette[color];
+}
+
+// Run the DMA until the end of the next frame's visible area
+static int next_frame(void)
+{
+  struct VGA_STATS stats;
+  vga_get_stats(&stats);
+  unsigned int start = stats.frames;
+  while (stats.frames == start) {
+    if (! host_dma_step()) {
+      printf("DMA chain stopped\n");
+      return 1;
+    }
+    vga_get_stats(&stats);
+  }
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  int w = (argc > 2) ? atoi(argv[1]) : 6;
+  int h = (argc > 2) ? atoi(argv[2]) : 8;
+  if (w < 1 || w > 8 || h < 1 || h > 32) {
+    fprintf(stderr, "USAGE: %s [font_w font_h]\n", argv[0]);
+    return 1;
+  }
+  lines = malloc(mode->h_pixels * mode->v_pixels);
+  if (! lines) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  make_font(w, h);
+  if (vga_init_text(mode, 2, &font) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  fill_text();
+
+  // the lines of a whole frame come between two frame ends
+  host_pio_set_read_func(pio_read);
+  if (next_frame() != 0) return 1;
+  num_lines = 0;
+  if (next_frame() != 0) return 1;
+
+  int errors = 0;
+  if (num_lines < mode->v_pixels) {
+    printf("%d lines, expected at least %d\n", num_lines, mode->v_pixels);
+    errors++;
+  }
+  for (int i = 0; i < mode->v_pixels && errors < 10; i++) {
+    const unsigned char *line = &lines[((num_lines + i) % mode->v_pixels) * mode->h_pixels];
+    int y = i / mode->v_div;
+    for (int x = 0; x < mode->h_pixels; x++) {
+      unsigned char got = line[x];
+      unsigned char expected = ref_pixel(x, y);
+      if (got != expected) {
+        printf("line %d, pixel %d: got 0x%02x, expected 0x%02x\n", y, x, got, expected);
+        errors++;
+        break;
+      }
+    }
+  }
+
+  printf("text mode %dx%d font, %dx%d cells: %s\n", w, h, vga_text.cols, vga_text.rows, errors ? "FAILED" : "OK");
+  free(lines);
+  return errors != 0;
+}
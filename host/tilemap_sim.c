@@ -0,0 +1,138 @@
+/**
+ * tilemap_sim.c
+ *
+ * Draws tilemaps with draw_tilemap() and checks every pixel of the
+ * framebuffer against a reference that reads each pixel from the map
+ * and its tile.  The maps have pseudo-random sizes (smaller and larger
+ * than the screen, so they wrap around) and tiles, and are drawn at
+ * scroll positions that cut tiles at every word and pixel, including
+ * negative ones and ones past the size of the map.  It's built once
+ * for each DRAW_TILE_SIZE checked by ctest.
+ *
+ * Usage: tilemap_sim [num_maps]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vga_6bit.h"
+#include "vga_draw.h"
+#include "host_sdk.h"
+
+#define NUM_TILES    6
+#define MAX_MAP_SIZE 24
+
+static unsigned int seed = 1;
+static unsigned char *ref;
+static unsigned int tiles[NUM_TILES * DRAW_TILE_SIZE * DRAW_TILE_SIZE/4];
+static unsigned char map[MAX_MAP_SIZE * MAX_MAP_SIZE];
+
+static unsigned int next_rand(void)
+{
+  seed = seed * 1103515245 + 12345;
+  return (seed >> 16) & 0x7fff;
+}
+
+static int wrap(int v, int size)
+{
+  v %= size;
+  return (v < 0) ? v + size : v;
+}
+
+static void make_tilemap(struct TILEMAP *tm)
+{
+  unsigned char *pixels = (unsigned char *) tiles;
+  for (int i = 0; i < (int) sizeof(tiles); i++) {
+    pixels[i] = vga_screen.sync_bits | (next_rand() & 0x3f);
+  }
+  tm->width  = 1 + next_rand() % MAX_MAP_SIZE;
+  tm->height = 1 + next_rand() % MAX_MAP_SIZE;
+  for (int i = 0; i < tm->width * tm->height; i++) {
+    map[i] = next_rand() % NUM_TILES;
+  }
+  tm->map = map;
+  tm->tiles = tiles;
+}
+
+static void ref_tilemap(const struct TILEMAP *tm, int scroll_x, int scroll_y)
+{
+  const unsigned char *pixels = (const unsigned char *) tm->tiles;
+  int map_width = tm->width * DRAW_TILE_SIZE;
+  int map_height = tm->height * DRAW_TILE_SIZE;
+  for (int py = 0; py < vga_screen.height; py++) {
+    int my = wrap(scroll_y + py, map_height);
+    for (int px = 0; px < vga_screen.width; px++) {
+      int mx = wrap((scroll_x & ~3) + px, map_width);
+      int tile = tm->map[(my / DRAW_TILE_SIZE) * tm->width + mx / DRAW_TILE_SIZE];
+      ref[py * vga_screen.width + px] =
+        pixels[(tile * DRAW_TILE_SIZE + my % DRAW_TILE_SIZE) * DRAW_TILE_SIZE + mx % DRAW_TILE_SIZE];
+    }
+  }
+}
+
+static int check_tilemap(const struct TILEMAP *tm, int scroll_x, int scroll_y)
+{
+  for (int py = 0; py < vga_screen.height; py++) {
+    memset(vga_screen.framebuffer[py], vga_screen.sync_bits, vga_screen.width);
+  }
+  ref_tilemap(tm, scroll_x, scroll_y);
+  draw_tilemap(tm, scroll_x, scroll_y);
+
+  for (int py = 0; py < vga_screen.height; py++) {
+    const unsigned char *line = (const unsigned char *) vga_screen.framebuffer[py];
+    for (int px = 0; px < vga_screen.width; px++) {
+      unsigned char expected = ref[py * vga_screen.width + px];
+      if (line[px] != expected) {
+        printf("%dx%d map scrolled to (%d, %d): pixel (%d, %d) is 0x%02x, expected 0x%02x\n",
+               tm->width, tm->height, scroll_x, scroll_y, px, py, line[px], expected);
+        return 1;
+      }
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char *argv[])
+{
+  int num_maps = (argc > 1) ? atoi(argv[1]) : 50;
+
+  if (vga_init(&vga_mode_320x240, 2) < 0) {
+    printf("ERROR initializing VGA\n");
+    return 1;
+  }
+  ref = malloc(vga_screen.width * vga_screen.height);
+  if (! ref) {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+
+  int errors = 0;
+  for (int i = 0; i < num_maps && errors < 10; i++) {
+    struct TILEMAP tm;
+    make_tilemap(&tm);
+    int map_width = tm.width * DRAW_TILE_SIZE;
+    int map_height = tm.height * DRAW_TILE_SIZE;
+
+    // the origin, the last pixel of the map, one tile and one pixel
+    // back, and random positions up to 2 map sizes away either way
+    int scrolls[][2] = {
+      { 0, 0 },
+      { map_width - 1, map_height - 1 },
+      { -DRAW_TILE_SIZE, -DRAW_TILE_SIZE },
+      { -1, -1 },
+    };
+    for (int s = 0; s < (int) count_of(scrolls); s++) {
+      errors += check_tilemap(&tm, scrolls[s][0], scrolls[s][1]);
+    }
+    for (int s = 0; s < 8; s++) {
+      int x = (int) (next_rand() % (4 * map_width)) - 2 * map_width;
+      int y = (int) (next_rand() % (4 * map_height)) - 2 * map_height;
+      errors += check_tilemap(&tm, x, y);
+    }
+  }
+
+  printf("%d tilemaps, %d pixel tiles: %s\n", num_maps, DRAW_TILE_SIZE, errors ? "FAILED" : "OK");
+  free(ref);
+  return errors != 0;
+}
@@ -0,0 +1,208 @@
+// Host stand-in for the header pioasm generates from vga_6bit.pio.
+// The instructions and the init functions are kept in sync with
+// vga_6bit.pio (the pio_header test checks them with pio_check), and
+// the sync programs are run by scanout_sim in PIO sync mode.
+
+#pragma once
+
+#include "hardware/pio.h"
+
+#define vga_wrap_target 0
+#define vga_wrap 0
+
+static const uint16_t vga_program_instructions[] = {
+            //     .wrap_target
+    0x6008, //  0: out    pins, 8
+            //     .wrap
+};
+
+static const struct pio_program vga_program = {
+    .instructions = vga_program_instructions,
+    .length = 1,
+    .origin = -1,
+};
+
+static inline pio_sm_config vga_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + vga_wrap_target, offset + vga_wrap);
+    return c;
+}
+
+static inline void vga_program_init(PIO pio, uint sm, uint offset, uint pin_base, float clock_div) {
+  const uint pin_count = 8;
+  for (uint i = 0; i < pin_count; i++) {
+      pio_gpio_init(pio, pin_base+i);
+  }
+  pio_sm_set_consecutive_pindirs(pio, sm, pin_base, pin_count, true);
+
+  pio_sm_config cfg = vga_program_get_default_config(offset);
+  sm_config_set_out_pins(&cfg, pin_base, pin_count);
+  sm_config_set_out_shift(&cfg, true, true, 0);
+  sm_config_set_fifo_join(&cfg, PIO_FIFO_JOIN_TX);
+  sm_config_set_clkdiv(&cfg, clock_div);
+  pio_sm_init(pio, sm, offset, &cfg);
+
+  pio_sm_set_enabled(pio, sm, true);
+}
+
+// --------------- //
+// vga_pixels      //
+// --------------- //
+
+#define vga_pixels_wrap_target 0
+#define vga_pixels_wrap 4
+
+static const uint16_t vga_pixels_program_instructions[] = {
+            //     .wrap_target
+    0x20c5, //  0: wait   1 irq, 5
+    0xa022, //  1: mov    x, y
+    0x6008, //  2: out    pins, 8
+    0x0042, //  3: jmp    x--, 2
+    0xa003, //  4: mov    pins, null
+            //     .wrap
+};
+
+static const struct pio_program vga_pixels_program = {
+    .instructions = vga_pixels_program_instructions,
+    .length = 5,
+    .origin = -1,
+};
+
+static inline pio_sm_config vga_pixels_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + vga_pixels_wrap_target, offset + vga_pixels_wrap);
+    return c;
+}
+
+// --------- //
+// vga_hsync //
+// --------- //
+
+#define vga_hsync_wrap_target 0
+#define vga_hsync_wrap 8
+
+static const uint16_t vga_hsync_program_instructions[] = {
+            //     .wrap_target
+    0x702a, //  0: out    x, 10           side 0
+    0x0041, //  1: jmp    x--, 1
+    0x782a, //  2: out    x, 10           side 1
+    0x0043, //  3: jmp    x--, 3
+    0xc004, //  4: irq    nowait 4
+    0x602c, //  5: out    x, 12
+    0x0046, //  6: jmp    x--, 6
+    0xc106, //  7: irq    nowait 6               [1]
+    0xa0e6, //  8: mov    osr, isr
+            //     .wrap
+};
+
+static const struct pio_program vga_hsync_program = {
+    .instructions = vga_hsync_program_instructions,
+    .length = 9,
+    .origin = -1,
+};
+
+static inline pio_sm_config vga_hsync_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + vga_hsync_wrap_target, offset + vga_hsync_wrap);
+    sm_config_set_sideset(&c, 2, true, false);
+    return c;
+}
+
+// --------- //
+// vga_vsync //
+// --------- //
+
+#define vga_vsync_wrap_target 0
+#define vga_vsync_wrap 16
+
+static const uint16_t vga_vsync_program_instructions[] = {
+            //     .wrap_target
+    0xa0e2, //  0: mov    osr, y
+    0xc044, //  1: irq    clear 4
+    0x602a, //  2: out    x, 10
+    0x20c4, //  3: wait   1 irq, 4
+    0xc005, //  4: irq    nowait 5
+    0x0043, //  5: jmp    x--, 3
+    0xc046, //  6: irq    clear 6
+    0x6028, //  7: out    x, 8
+    0x20c6, //  8: wait   1 irq, 6
+    0x0048, //  9: jmp    x--, 8
+    0x7026, // 10: out    x, 6            side 0
+    0x20c6, // 11: wait   1 irq, 6
+    0x004b, // 12: jmp    x--, 11
+    0x7828, // 13: out    x, 8            side 1
+    0x20c6, // 14: wait   1 irq, 6
+    0x004e, // 15: jmp    x--, 14
+    0x8000, // 16: push   noblock
+            //     .wrap
+};
+
+static const struct pio_program vga_vsync_program = {
+    .instructions = vga_vsync_program_instructions,
+    .length = 17,
+    .origin = -1,
+};
+
+static inline pio_sm_config vga_vsync_program_get_default_config(uint offset) {
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + vga_vsync_wrap_target, offset + vga_vsync_wrap);
+    sm_config_set_sideset(&c, 2, true, false);
+    return c;
+}
+
+static inline void vga_pixels_program_init(PIO pio, uint sm, uint offset, uint pin_base, uint pin_count, float clock_div, uint h_pixels) {
+  for (uint i = 0; i < pin_count; i++) {
+      pio_gpio_init(pio, pin_base+i);
+  }
+  pio_sm_set_consecutive_pindirs(pio, sm, pin_base, pin_count, true);
+
+  pio_sm_config cfg = vga_pixels_program_get_default_config(offset);
+  sm_config_set_out_pins(&cfg, pin_base, pin_count);
+  sm_config_set_out_shift(&cfg, true, true, 32);
+  sm_config_set_fifo_join(&cfg, PIO_FIFO_JOIN_TX);
+  sm_config_set_clkdiv(&cfg, clock_div);
+  pio_sm_init(pio, sm, offset, &cfg);
+
+  // y = number of pixels per line - 1, then leave OSR empty for autopull
+  pio_sm_put_blocking(pio, sm, h_pixels - 1);
+  pio_sm_exec(pio, sm, pio_encode_pull(false, false));
+  pio_sm_exec(pio, sm, pio_encode_mov(pio_y, pio_osr));
+  pio_sm_exec(pio, sm, pio_encode_out(pio_null, 32));
+}
+
+static inline void vga_hsync_program_init(PIO pio, uint sm, uint offset, uint pin, float clock_div, uint32_t timing) {
+  pio_gpio_init(pio, pin);
+  pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, true);
+
+  pio_sm_config cfg = vga_hsync_program_get_default_config(offset);
+  sm_config_set_set_pins(&cfg, pin, 1);
+  sm_config_set_sideset_pins(&cfg, pin);
+  sm_config_set_out_shift(&cfg, true, false, 32);
+  sm_config_set_clkdiv(&cfg, clock_div);
+  pio_sm_init(pio, sm, offset, &cfg);
+
+  // isr = line timing
+  pio_sm_put_blocking(pio, sm, timing);
+  pio_sm_exec(pio, sm, pio_encode_pull(false, false));
+  pio_sm_exec(pio, sm, pio_encode_mov(pio_isr, pio_osr));
+  pio_sm_exec(pio, sm, pio_encode_set(pio_pins, 1));
+}
+
+static inline void vga_vsync_program_init(PIO pio, uint sm, uint offset, uint pin, float clock_div, uint32_t timing) {
+  pio_gpio_init(pio, pin);
+  pio_sm_set_consecutive_pindirs(pio, sm, pin, 1, true);
+
+  pio_sm_config cfg = vga_vsync_program_get_default_config(offset);
+  sm_config_set_set_pins(&cfg, pin, 1);
+  sm_config_set_sideset_pins(&cfg, pin);
+  sm_config_set_out_shift(&cfg, true, false, 32);
+  sm_config_set_in_shift(&cfg, true, false, 32);
+  sm_config_set_clkdiv(&cfg, clock_div);
+  pio_sm_init(pio, sm, offset, &cfg);
+
+  // y = frame timing
+  pio_sm_put_blocking(pio, sm, timing);
+  pio_sm_exec(pio, sm, pio_encode_pull(false, false));
+  pio_sm_exec(pio, sm, pio_encode_mov(pio_y, pio_osr));
+  pio_sm_exec(pio, sm, pio_encode_set(pio_pins, 1));
+}
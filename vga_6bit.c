@@ -33,8 +33,13 @@
 #include "hardware/clocks.h"
 #include "hardware/pio.h"
 #include "hardware/dma.h"
+#include "hardware/gpio.h"
 #include "hardware/irq.h"
+#include "hardware/sync.h"
 #include "hardware/structs/bus_ctrl.h"
+#if VGA_ENABLE_MULTICORE
+#include "pico/multicore.h"
+#endif
 
 #include "vga_6bit.h"
 #include "vga_6bit.pio.h"
@@ -69,37 +74,251 @@ const static struct VGA_MODE *vga_mode = NULL;
 #define VSYNC_OFF          ( V_POLARITY)
 #define HBLANK_BUFFER_LEN  ((H_FRONT_PORCH+H_SYNC_PULSE+H_BACK_PORCH)/4)
 #define HPIXELS_BUFFER_LEN (H_PIXELS/4)
+#define FULL_LINE_LEN      (H_FULL_LINE/4)
 
-#define SYNC_BITS     ((VSYNC_OFF<<7) | (HSYNC_OFF<<6))
 #define SCREEN_WIDTH  H_PIXELS
 #define SCREEN_HEIGHT (V_PIXELS/V_DIV)
 
-static unsigned int *hblank_buffer_vsync_on;
-static unsigned int *hblank_buffer_vsync_off;
-static unsigned int *hpixels_buffer_vsync_on;
-static unsigned int *hpixels_buffer_vsync_off;
-static unsigned int *framebuffers[2];
-static unsigned int **cur_framebuffer_lines;
+#define MAX_FRAMEBUFFERS   3
 
+#if VGA_ENABLE_PIO_SYNC
+// the PIO generates the sync signals and blanking, so the DMA only sends pixels
+#define SYNC_BITS          0
+#define LINE_BUFFER_HBLANK 0
+#define VISIBLE_CHAIN_LEN  (V_PIXELS+2)         // DMA blocks for visible lines + wait for vblank end + restart
+#else
+#define SYNC_BITS          ((VSYNC_OFF<<7) | (HSYNC_OFF<<6))
+#define LINE_BUFFER_HBLANK HBLANK_BUFFER_LEN    // scanline buffers start with hblank, so each line is a single DMA block
+#define VISIBLE_CHAIN_LEN  (2*V_PIXELS+1)       // DMA blocks for visible lines + jump to blank chain
+
+// Runs of identical blank lines are sent VGA_BLANK_BLOCK_LINES lines
+// per DMA block, from buffers holding that many copies of the line.
+// Each extra copy costs a full line of RAM, so more than 2 uses more
+// memory than the DMA blocks it saves in the 640x480 timing.
+#ifndef VGA_BLANK_BLOCK_LINES
+#define VGA_BLANK_BLOCK_LINES 2
+#endif
+#define BLANK_BLOCKS(lines) (((lines) + VGA_BLANK_BLOCK_LINES-1) / VGA_BLANK_BLOCK_LINES)
+#define BLANK_CHAIN_LEN     (BLANK_BLOCKS(V_FRONT_PORCH) + BLANK_BLOCKS(V_SYNC_PULSE) + BLANK_BLOCKS(V_BACK_PORCH) + 1)
+#define VSYNC_ON_LINES      ((V_SYNC_PULSE < VGA_BLANK_BLOCK_LINES) ? V_SYNC_PULSE : VGA_BLANK_BLOCK_LINES)
+#endif
+#define LINE_BUFFER_LEN    (LINE_BUFFER_HBLANK + HPIXELS_BUFFER_LEN)
+
+#if ! VGA_ENABLE_PIO_SYNC
+static unsigned int *blank_lines_vsync_on;    // VSYNC_ON_LINES full blank lines with vsync active
+static unsigned int *blank_lines_vsync_off;   // VGA_BLANK_BLOCK_LINES full blank lines, the first hblank is used for visible lines
+#endif
+static unsigned int *framebuffers[MAX_FRAMEBUFFERS];
+static unsigned int **framebuffer_lines[MAX_FRAMEBUFFERS];
+static int num_framebuffers;
+
+// Framebuffers can be larger than the screen (a virtual canvas).  The
+// screen shows the window at the scroll origin, which is set in the
+// DMA chain of each framebuffer just before it's shown.
+static int canvas_width;
+static int canvas_height;
+static int scroll_x;                             // requested scroll origin (protected by frame_lock)
+static int scroll_y;
+static int chain_scroll_x[MAX_FRAMEBUFFERS];     // scroll origin in each framebuffer's chain
+static int chain_scroll_y[MAX_FRAMEBUFFERS];
+
+// scanline mode: the screen is rendered line by line into a small ring of buffers
+static unsigned int *line_buffers;
+static int num_line_buffers;
+static vga_scanline_func scanline_func;
+static int scanline_next;          // next screen line to render
+static bool scanline_vblank;       // true after the frame is over until the next one starts
+static volatile uint scanline_late;
+
+// all fields are register-sized, since the control channel copies them straight to the data channel registers
 struct DMA_BUFFER_INFO {
   uintptr_t read_addr;
   uintptr_t write_addr;
-  uint32_t  transfer_count;
-  uint32_t  ctrl_trig;
+  uintptr_t transfer_count;
+  uintptr_t ctrl_trig;
 };
-static struct DMA_BUFFER_INFO *dma_chain;
+
+// Each framebuffer has its own chain for the visible lines, so
+// swapping buffers just changes the chain used in the next frame.
+// All visible chains end by jumping to the blank chain (front porch,
+// vsync and back porch), which ends by jumping to the visible chain
+// in dma_restart_buffer.  With VGA_ENABLE_PIO_SYNC there's no blank
+// chain: the visible chains wait for the vsync state machine to signal
+// the end of vblank, then jump to dma_restart_buffer.
+static struct DMA_BUFFER_INFO *dma_chains[MAX_FRAMEBUFFERS];
+static int dma_line_blocks;            // DMA blocks per visible line in dma_chains
+#if VGA_ENABLE_PIO_SYNC
+static uint32_t dma_vblank_end_word;   // destination for the word read from the vsync state machine
+static uint pio_sync_sm_mask;
+#else
+static struct DMA_BUFFER_INFO *dma_blank_chain;
+static void *dma_blank_chain_start[1];
+#endif
 static void *dma_restart_buffer[1];
 static uint dma_control_chan;
 static uint dma_data_chan;
 
+// Background clear of the framebuffer being drawn: a DMA channel
+// (claimed on first use) repeatedly writes dma_clear_word.
+static int dma_clear_chan = -1;
+static int dma_clear_fb = -1;         // framebuffer cleared last, -1 if none
+static uint32_t dma_clear_word;
+static int auto_clear_color = -1;
+
 static volatile uint frame_count;
-static uint cur_framebuffer;
+
+// Scanout statistics, updated by the DMA IRQ handler.  The TXSTALL
+// flag of the state machine receiving pixels is set when it runs out
+// of data, i.e. the DMA didn't keep up; it's checked (and cleared) on
+// each interrupt and counted once per frame.
+static uint32_t pio_stall_bits;
+static bool frame_underrun;
+static volatile uint stats_underrun_frames;
+static volatile uint stats_repeated_frames;
+static uint stats_start_frame;
+static uint stats_start_late_lines;
+
+// Frame queue: framebuffers submitted for display wait in
+// frame_queue until the end of a frame, when the first is shown.  A
+// framebuffer that is not shown, queued or being drawn is free.
+// Shared with the DMA IRQ handler, protected by frame_lock.
+static spin_lock_t *frame_lock;
+static enum VGA_FRAME_POLICY frame_policy;
+static int frame_queue[MAX_FRAMEBUFFERS];
+static int frame_queue_len;
+static int shown_framebuffer;
+static int cur_framebuffer;       // framebuffer being drawn, -1 if none
 struct VGA_SCREEN vga_screen;
 
+// Return the screen line currently being sent to the monitor, -1
+// if the frame's first visible line wasn't reached yet, or
+// SCREEN_HEIGHT if the frame's last visible line is already done.
+static int __time_critical_func(get_scanout_line)(void)
+{
+  // the control channel has already loaded the block after the one being output
+  uintptr_t next = dma_hw->ch[dma_control_chan].read_addr;
+  uintptr_t visible = (uintptr_t) dma_chains[0];
+  if (next >= visible && next <= visible + VISIBLE_CHAIN_LEN*sizeof(struct DMA_BUFFER_INFO)) {
+    int block = (int) ((next - visible) / sizeof(struct DMA_BUFFER_INFO)) - 1;
+    if (block < 0) return -1;
+    int line = block/dma_line_blocks / V_DIV;
+    return (line < SCREEN_HEIGHT) ? line : SCREEN_HEIGHT;
+  }
+
+#if VGA_ENABLE_PIO_SYNC
+  return SCREEN_HEIGHT;
+#else
+  // blank chain: front porch comes after the visible lines, vsync and back porch before
+  int block = (int) ((next - (uintptr_t) dma_blank_chain) / sizeof(struct DMA_BUFFER_INFO)) - 1;
+  return (block < BLANK_BLOCKS(V_FRONT_PORCH)) ? SCREEN_HEIGHT : -1;
+#endif
+}
+
+// Count the frame that just ended in the statistics.
+static void __time_critical_func(end_frame_stats)(void)
+{
+  if (frame_underrun) {
+    stats_underrun_frames++;
+    frame_underrun = false;
+  }
+}
+
+// Render every line whose ring buffer is no longer needed by the
+// beam.  The buffer for line y is (y % num_line_buffers), so line y
+// can be rendered as soon as line y-num_line_buffers is done.
+static void __time_critical_func(render_scanlines)(void)
+{
+  int line = get_scanout_line();
+
+  if (line >= SCREEN_HEIGHT && ! scanline_vblank) {
+    // frame is over: lines not rendered by now were never shown
+    scanline_vblank = true;
+    scanline_late += SCREEN_HEIGHT - scanline_next;
+    scanline_next = 0;
+    end_frame_stats();
+    frame_count++;
+  } else if (line >= 0 && line < SCREEN_HEIGHT) {
+    scanline_vblank = false;
+  }
+
+  int first = (line >= 0 && line < SCREEN_HEIGHT) ? line : 0;
+  if (scanline_next < first) {
+    // too late for these lines, skip them
+    scanline_late += first - scanline_next;
+    scanline_next = first;
+  }
+
+  while (scanline_next < SCREEN_HEIGHT && scanline_next < first + num_line_buffers) {
+    int y = scanline_next++;
+    scanline_func(&line_buffers[(y % num_line_buffers) * LINE_BUFFER_LEN + LINE_BUFFER_HBLANK], y);
+
+    // check if the beam got to the line before we were done with it
+    int now = get_scanout_line();
+    if ((now >= y && now < SCREEN_HEIGHT) || (now >= SCREEN_HEIGHT && ! scanline_vblank)) {
+      scanline_late++;
+    }
+  }
+}
+
+// point the screen line `line` of a DMA chain to src
+static void __time_critical_func(set_chain_line_source)(struct DMA_BUFFER_INFO *chain, int line, const void *src)
+{
+  for (int i = line*V_DIV; i < (line+1)*V_DIV; i++) {
+    chain[dma_line_blocks*(i+1) - 1].read_addr = (uintptr_t) src;
+  }
+}
+
+// point the chain of framebuffer fb to the canvas window at (x, y)
+static void __time_critical_func(set_chain_scroll)(int fb, int x, int y)
+{
+  int canvas_y = y;
+  for (int line = 0; line < SCREEN_HEIGHT; line++) {
+    set_chain_line_source(dma_chains[fb], line, framebuffer_lines[fb][canvas_y] + x/4);
+    if (++canvas_y == canvas_height) canvas_y = 0;
+  }
+  chain_scroll_x[fb] = x;
+  chain_scroll_y[fb] = y;
+}
+
+// Called at the end of the visible area of each frame (and, in
+// scanline mode, at the end of each line).  The restart block is only
+// read after the blank lines, so the chain set here is used for the
+// whole next frame.
 static void __isr __time_critical_func(dma_handler)(void)
 {
   dma_hw->ints0 = 1u << dma_data_chan;
-  frame_count++;
+
+  // the state machine stalls until the DMA starts, so skip the first frame
+  if (pio0->fdebug & pio_stall_bits) {
+    pio0->fdebug = pio_stall_bits;
+    if (frame_count > 0) frame_underrun = true;
+  }
+
+  if (scanline_func) {
+    render_scanlines();
+  } else {
+    uint32_t save = spin_lock_blocking(frame_lock);
+    if (frame_queue_len > 0) {
+      shown_framebuffer = frame_queue[0];
+      for (int i = 1; i < frame_queue_len; i++) {
+        frame_queue[i-1] = frame_queue[i];
+      }
+      frame_queue_len--;
+      dma_restart_buffer[0] = dma_chains[shown_framebuffer];
+    } else if (num_framebuffers > 1) {
+      stats_repeated_frames++;
+    }
+    int x = scroll_x;
+    int y = scroll_y;
+    spin_unlock(frame_lock, save);
+
+    // the visible lines are not read again until the restart
+    if (x != chain_scroll_x[shown_framebuffer] || y != chain_scroll_y[shown_framebuffer]) {
+      set_chain_scroll(shown_framebuffer, x, y);
+    }
+    end_frame_stats();
+    frame_count++;
+  }
 }
 
 static void set_dma_buffer_src(struct DMA_BUFFER_INFO *buf, volatile void *src, uint32_t count)
@@ -114,6 +333,49 @@ static void set_dma_buffer_dst(struct DMA_BUFFER_INFO *buf, volatile void *dest,
   buf->ctrl_trig = ctrl;
 }
 
+// set all blocks of the chain to trigger dma_data_chan to copy data to PIO
+static void set_dma_chain_dst_pio(struct DMA_BUFFER_INFO *chain, int num_blocks, volatile void *pio_txf, uint pio_dreq)
+{
+  for (int i = 0; i < num_blocks; i++) {
+    set_dma_buffer_dst(&chain[i],
+                       pio_txf,                                                    // write to PIO
+                       DMA_CH0_CTRL_TRIG_INCR_READ_BITS                         |  // increment read ptr
+                       (pio_dreq            << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)  |  // as fast as PIO requires
+                       (dma_control_chan    << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)  |  // chain to dma_control_chan
+                       (((uint)DMA_SIZE_32) << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB) |  // copy 32 bits per count
+                       DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS                         |  // suppress IRQ
+                       DMA_CH0_CTRL_TRIG_EN_BITS);
+  }
+}
+
+// set block to trigger dma_data_chan to copy the chain start address in *next_chain to the control chain
+static void set_dma_buffer_jump(struct DMA_BUFFER_INFO *buf, void **next_chain)
+{
+  set_dma_buffer_src(buf, next_chain, 1);
+  set_dma_buffer_dst(buf,
+                     &dma_hw->ch[dma_control_chan].al3_read_addr_trig,           // write to dma_control_chan read address trigger
+                     (DREQ_FORCE          << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)  |  // as fast as possible
+                     (dma_data_chan       << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)  |  // chain to itself (don't chain)
+                     (((uint)DMA_SIZE_32) << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB) |  // copy 32 bits per count
+                     DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS                         |  // suppress IRQ
+                     DMA_CH0_CTRL_TRIG_EN_BITS);
+}
+
+#if VGA_ENABLE_PIO_SYNC
+// set block to make dma_data_chan wait for the word the vsync state machine sends at the end of vblank
+static void set_dma_buffer_wait_vblank(struct DMA_BUFFER_INFO *buf, volatile void *pio_rxf, uint pio_dreq)
+{
+  set_dma_buffer_src(buf, pio_rxf, 1);
+  set_dma_buffer_dst(buf,
+                     &dma_vblank_end_word,                                       // write to dummy variable
+                     (pio_dreq            << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)  |  // when the vsync state machine sends it
+                     (dma_control_chan    << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)  |  // chain to dma_control_chan
+                     (((uint)DMA_SIZE_32) << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB) |  // copy 32 bits per count
+                     DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS                         |  // suppress IRQ
+                     DMA_CH0_CTRL_TRIG_EN_BITS);
+}
+#endif
+
 static int init_pio(unsigned int pin_out_base)
 {
   PIO pio = pio0;
@@ -122,10 +384,40 @@ static int init_pio(unsigned int pin_out_base)
 
   // choose PIO clock divider based on the CPU clock and VGA pixel clock
   uint f_clk_sys = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_SYS);
+
+#if VGA_ENABLE_PIO_SYNC
+  // pixels, hsync and vsync state machines, all running at 2 cycles per pixel
+  float clock_div = ((float)f_clk_sys * 1000.f) / (2.f * (float)PIX_CLOCK_MHZ);
+  uint sm_hsync = pio_claim_unused_sm(pio, true);
+  uint sm_vsync = pio_claim_unused_sm(pio, true);
+  uint vblank_dreq = pio_get_dreq(pio, sm_vsync, false);
+
+  uint32_t hsync_timing = (((2*H_SYNC_PULSE - 2)                   ) |
+                           ((2*H_BACK_PORCH - 7)               << 10) |
+                           ((2*(H_PIXELS + H_FRONT_PORCH) - 1) << 20));
+  uint32_t vsync_timing = (((V_PIXELS - 1)          ) |
+                           ((V_FRONT_PORCH)     << 10) |
+                           ((V_SYNC_PULSE - 1)  << 18) |
+                           ((V_BACK_PORCH - 1)  << 24));
+
+  vga_pixels_program_init(pio, sm,       pio_add_program(pio, &vga_pixels_program), pin_out_base,   6, clock_div, H_PIXELS);
+  vga_hsync_program_init (pio, sm_hsync, pio_add_program(pio, &vga_hsync_program),  pin_out_base+6,    clock_div, hsync_timing);
+  vga_vsync_program_init (pio, sm_vsync, pio_add_program(pio, &vga_vsync_program),  pin_out_base+7,    clock_div, vsync_timing);
+
+  // the programs generate active low sync pulses
+  gpio_set_outover(pin_out_base+6, HSYNC_ON ? GPIO_OVERRIDE_INVERT : GPIO_OVERRIDE_NORMAL);
+  gpio_set_outover(pin_out_base+7, VSYNC_ON ? GPIO_OVERRIDE_INVERT : GPIO_OVERRIDE_NORMAL);
+
+  // the state machines are started by init_vga() after the DMA
+  pio_sync_sm_mask = (1u << sm) | (1u << sm_hsync) | (1u << sm_vsync);
+#else
   float clock_div = ((float)f_clk_sys * 1000.f) / (float)PIX_CLOCK_MHZ;
 
   uint offset = pio_add_program(pio, &vga_program);
   vga_program_init(pio, sm, offset, pin_out_base, clock_div);
+#endif
+
+  pio_stall_bits = 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
 
   dma_control_chan = dma_claim_unused_channel(true);
   dma_data_chan    = dma_claim_unused_channel(true);
@@ -140,33 +432,44 @@ static int init_pio(unsigned int pin_out_base)
   dma_channel_configure(dma_control_chan,
                         &cfg,
                         &dma_hw->ch[dma_data_chan].read_addr,     // dest (update data channel and trigger it)
-                        &dma_chain[0],                            // source
+#if VGA_ENABLE_PIO_SYNC
+                        &dma_chains[0][0],                        // source
+#else
+                        &dma_blank_chain[0],                      // source
+#endif
                         4,                                        // num words for each transfer
                         false                                     // don't start now
                         );
 
-  // all blocks of dma_chain except last are set to trigger dma_data_chan to copy data to PIO
-  for (int i = 0; i < 2*V_FULL_FRAME; i++) {
-    // src will be set by init_buffers() and vga_swap_buffers()
-    set_dma_buffer_dst(&dma_chain[i],
-                       &pio->txf[sm],                                              // write to PIO
-                       DMA_CH0_CTRL_TRIG_INCR_READ_BITS                         |  // increment read ptr
-                       (pio_dreq            << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)  |  // as fast as PIO requires
-                       (dma_control_chan    << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)  |  // chain to dma_control_chan
-                       (((uint)DMA_SIZE_32) << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB) |  // copy 32 bits per count
-                       DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS                         |  // suppress IRQ
-                       DMA_CH0_CTRL_TRIG_EN_BITS);
+  int num_chains = (num_framebuffers > 0) ? num_framebuffers : 1;
+  for (int i = 0; i < num_chains; i++) {
+    struct DMA_BUFFER_INFO *chain = dma_chains[i];
+    set_dma_chain_dst_pio(chain, dma_line_blocks*V_PIXELS, &pio->txf[sm], pio_dreq);
+#if VGA_ENABLE_PIO_SYNC
+    // visible chains (src set by init_buffers()) end waiting for the end of vblank and restarting
+    set_dma_buffer_wait_vblank(&chain[V_PIXELS], &pio->rxf[sm_vsync], vblank_dreq);
+    set_dma_buffer_jump(&chain[V_PIXELS+1], dma_restart_buffer);
+#else
+    // visible chains (src set by init_buffers()) end jumping to the blank chain
+    set_dma_buffer_jump(&chain[dma_line_blocks*V_PIXELS], dma_blank_chain_start);
+#endif
+
+    // trigger IRQ after the last visible line
+    chain[dma_line_blocks*V_PIXELS-1].ctrl_trig &= ~DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS;
   }
 
-  // last block of dma_chain is set to trigger dma_data_chan to copy the dma_chain start address to the control chain (restarting it)
-  set_dma_buffer_src(&dma_chain[2*V_FULL_FRAME], dma_restart_buffer, 1);
-  set_dma_buffer_dst(&dma_chain[2*V_FULL_FRAME],
-                     &dma_hw->ch[dma_control_chan].al3_read_addr_trig,           // write to dma_control_chan read address trigger
-                     (DREQ_FORCE          << DMA_CH0_CTRL_TRIG_TREQ_SEL_LSB)  |  // as fast as possible
-                     (dma_data_chan       << DMA_CH0_CTRL_TRIG_CHAIN_TO_LSB)  |  // chain to itself (don't chain)
-                     (((uint)DMA_SIZE_32) << DMA_CH0_CTRL_TRIG_DATA_SIZE_LSB) |  // copy 32 bits per count
-                     0                                                        |  // trigger IRQ
-                     DMA_CH0_CTRL_TRIG_EN_BITS);
+#if ! VGA_ENABLE_PIO_SYNC
+  // blank chain ends restarting the visible chain in dma_restart_buffer
+  set_dma_chain_dst_pio(dma_blank_chain, BLANK_CHAIN_LEN-1, &pio->txf[sm], pio_dreq);
+  set_dma_buffer_jump(&dma_blank_chain[BLANK_CHAIN_LEN-1], dma_restart_buffer);
+#endif
+
+  // in scanline mode, trigger IRQ after the last time each line is sent so its buffer can be reused
+  if (scanline_func) {
+    for (int i = V_DIV-1; i < V_PIXELS; i += V_DIV) {
+      dma_chains[0][dma_line_blocks*(i+1) - 1].ctrl_trig &= ~DMA_CH0_CTRL_TRIG_IRQ_QUIET_BITS;
+    }
+  }
 
   dma_channel_set_irq0_enabled(dma_data_chan, true);
   irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
@@ -179,155 +482,566 @@ static int init_pio(unsigned int pin_out_base)
 static void clear_framebuffer(uint fb_num, uint8_t color)
 {
   uint8_t val = SYNC_BITS | (color & 0x3f);
-  memset(framebuffers[fb_num], val, SCREEN_WIDTH*SCREEN_HEIGHT);
+  memset(framebuffers[fb_num], val, canvas_width*canvas_height);
 }
 
-static int alloc_buffers(int num_framebuffers)
+static void start_dma_clear(int fb_num, uint8_t color)
 {
-  for (int i = 0; i < num_framebuffers; i++) {
-    framebuffers[i] = NULL;
+  vga_clear_wait();
+  if (dma_clear_chan < 0) {
+    dma_clear_chan = dma_claim_unused_channel(false);
+    if (dma_clear_chan < 0) {
+      clear_framebuffer(fb_num, color);
+      return;
+    }
+  }
+
+  dma_clear_word = (SYNC_BITS | (color & 0x3f)) * 0x01010101u;
+  dma_clear_fb = fb_num;
+
+  dma_channel_config cfg = dma_channel_get_default_config(dma_clear_chan);
+  channel_config_set_transfer_data_size(&cfg, DMA_SIZE_32);
+  channel_config_set_read_increment(&cfg, false);
+  channel_config_set_write_increment(&cfg, true);
+  dma_channel_configure(dma_clear_chan,
+                        &cfg,
+                        framebuffers[fb_num],                 // dest
+                        &dma_clear_word,                      // source
+                        canvas_width*canvas_height/4,         // num words (canvas_width is a multiple of 4)
+                        true                                  // start now
+                        );
+}
+
+static int alloc_buffers(void)
+{
+  int num_chains = (num_framebuffers > 0) ? num_framebuffers : 1;
+  for (int i = 0; i < MAX_FRAMEBUFFERS; i++) {
+    framebuffers[i]      = NULL;
+    framebuffer_lines[i] = NULL;
+    dma_chains[i]        = NULL;
   }
-  cur_framebuffer_lines    = NULL;
-  hblank_buffer_vsync_on   = NULL;
-  hblank_buffer_vsync_off  = NULL;
-  hpixels_buffer_vsync_on  = NULL;
-  hpixels_buffer_vsync_off = NULL;
-  dma_chain                = NULL;
+  line_buffers             = NULL;
+#if ! VGA_ENABLE_PIO_SYNC
+  blank_lines_vsync_on     = NULL;
+  blank_lines_vsync_off    = NULL;
+  dma_blank_chain          = NULL;
+#endif
 
 #define ALLOC(p, size)  p = malloc(size); if (! p) goto error
   for (int i = 0; i < num_framebuffers; i++) {
-    ALLOC(framebuffers[i], SCREEN_WIDTH * SCREEN_HEIGHT);
-  }
-  ALLOC(cur_framebuffer_lines,    SCREEN_HEIGHT      * sizeof(unsigned int *));
-  ALLOC(hblank_buffer_vsync_on,   HBLANK_BUFFER_LEN  * sizeof(unsigned int));
-  ALLOC(hblank_buffer_vsync_off,  HBLANK_BUFFER_LEN  * sizeof(unsigned int));
-  ALLOC(hpixels_buffer_vsync_on,  HPIXELS_BUFFER_LEN * sizeof(unsigned int));
-  ALLOC(hpixels_buffer_vsync_off, HPIXELS_BUFFER_LEN * sizeof(unsigned int));
-  ALLOC(dma_chain,                (2*V_FULL_FRAME+1) * sizeof(struct DMA_BUFFER_INFO));
+    ALLOC(framebuffers[i],        canvas_width * canvas_height);
+    ALLOC(framebuffer_lines[i],   canvas_height      * sizeof(unsigned int *));
+  }
+  for (int i = 0; i < num_chains; i++) {
+    ALLOC(dma_chains[i],          VISIBLE_CHAIN_LEN  * sizeof(struct DMA_BUFFER_INFO));
+  }
+  if (num_line_buffers > 0) {
+    ALLOC(line_buffers,           num_line_buffers   * LINE_BUFFER_LEN * sizeof(unsigned int));
+  }
+#if ! VGA_ENABLE_PIO_SYNC
+  ALLOC(blank_lines_vsync_on,     VSYNC_ON_LINES        * FULL_LINE_LEN * sizeof(unsigned int));
+  ALLOC(blank_lines_vsync_off,    VGA_BLANK_BLOCK_LINES * FULL_LINE_LEN * sizeof(unsigned int));
+  ALLOC(dma_blank_chain,          BLANK_CHAIN_LEN    * sizeof(struct DMA_BUFFER_INFO));
+#endif
 #undef ALLOC
 
   return 0;
 
  error:
-  for (int i = 0; i < num_framebuffers; i++) {
+  for (int i = 0; i < MAX_FRAMEBUFFERS; i++) {
     free(framebuffers[i]);
+    free(framebuffer_lines[i]);
+    free(dma_chains[i]);
   }
-  free(cur_framebuffer_lines);
-  free(hblank_buffer_vsync_on);
-  free(hblank_buffer_vsync_off);
-  free(hpixels_buffer_vsync_on);
-  free(hpixels_buffer_vsync_off);
-  free(dma_chain);
+  free(line_buffers);
+#if ! VGA_ENABLE_PIO_SYNC
+  free(blank_lines_vsync_on);
+  free(blank_lines_vsync_off);
+  free(dma_blank_chain);
+#endif
   return -1;
 }
 
-static int init_buffers(int num_framebuffers)
+#if ! VGA_ENABLE_PIO_SYNC
+// fill num_lines full blank lines
+static void fill_blank_lines(unsigned int *lines, int num_lines, uint8_t vsync)
 {
-  if (alloc_buffers(num_framebuffers) < 0) {
-    return VGA_ERROR_ALLOC;
+  unsigned char *p = (unsigned char *) lines;
+  for (int line = 0; line < num_lines; line++) {
+    for (int i = 0; i < H_FULL_LINE; i++) {
+      uint8_t hsync = (i >= H_FRONT_PORCH && i < H_FRONT_PORCH+H_SYNC_PULSE) ? HSYNC_ON : HSYNC_OFF;
+      *p++ = (vsync<<7) | (hsync<<6);
+    }
   }
+}
 
-  uint8_t sync_h0v0 = (VSYNC_OFF<<7) | (HSYNC_OFF<<6);
-  uint8_t sync_h1v0 = (VSYNC_OFF<<7) | (HSYNC_ON <<6);
-  uint8_t sync_h0v1 = (VSYNC_ON <<7) | (HSYNC_OFF<<6);
-  uint8_t sync_h1v1 = (VSYNC_ON <<7) | (HSYNC_ON <<6);
-  
-  // hblank lines
-  unsigned char *hblank_vsync_on   = (unsigned char *) hblank_buffer_vsync_on;
-  unsigned char *hblank_vsync_off  = (unsigned char *) hblank_buffer_vsync_off;
-  for (int i = 0; i < H_FRONT_PORCH+H_SYNC_PULSE+H_BACK_PORCH; i++) {
-    if (i >= H_FRONT_PORCH && i < H_FRONT_PORCH+H_SYNC_PULSE) {
-      hblank_vsync_on[i]  = sync_h1v1;
-      hblank_vsync_off[i] = sync_h1v0;
-    } else {
-      hblank_vsync_on[i]  = sync_h0v1;
-      hblank_vsync_off[i] = sync_h0v0;
-    }
+// set blocks to send num_lines copies of a blank line from a buffer with up to VGA_BLANK_BLOCK_LINES of them
+static struct DMA_BUFFER_INFO *set_dma_blank_lines_src(struct DMA_BUFFER_INFO *buf, unsigned int *lines, int num_lines)
+{
+  while (num_lines > 0) {
+    int n = (num_lines < VGA_BLANK_BLOCK_LINES) ? num_lines : VGA_BLANK_BLOCK_LINES;
+    set_dma_buffer_src(buf++, lines, n * FULL_LINE_LEN);
+    num_lines -= n;
   }
+  return buf;
+}
+#endif
 
-  // vblank pixel lines
-  memset(hpixels_buffer_vsync_on,  sync_h0v1, H_PIXELS);
-  memset(hpixels_buffer_vsync_off, sync_h0v0, H_PIXELS);
+static int init_buffers(void)
+{
+  if (alloc_buffers() < 0) {
+    return VGA_ERROR_ALLOC;
+  }
+
+#if VGA_ENABLE_PIO_SYNC
+  dma_line_blocks = 1;   // pixels
+#else
+  // scanline buffers include hblank; framebuffer lines need a separate block for it
+  dma_line_blocks = (num_line_buffers > 0) ? 1 : 2;
+
+  // blank lines
+  fill_blank_lines(blank_lines_vsync_on,  VSYNC_ON_LINES,        VSYNC_ON);
+  fill_blank_lines(blank_lines_vsync_off, VGA_BLANK_BLOCK_LINES, VSYNC_OFF);
+#endif
 
   // framebuffers
   for (int i = 0; i < num_framebuffers; i++) {
     clear_framebuffer(i, 0);
   }
+
+  // line buffers
+  for (int i = 0; i < num_line_buffers; i++) {
+    unsigned int *line = &line_buffers[i * LINE_BUFFER_LEN];
+#if ! VGA_ENABLE_PIO_SYNC
+    memcpy(line, blank_lines_vsync_off, HBLANK_BUFFER_LEN * sizeof(unsigned int));
+#endif
+    memset(&line[LINE_BUFFER_HBLANK], SYNC_BITS, H_PIXELS);
+  }
   
-  // setup DMA chain buffers
-  struct DMA_BUFFER_INFO *buf = &dma_chain[0];
-  for (int i = 0; i < V_FULL_FRAME; i++) {
-    if (i < V_SYNC_PULSE) {
-      // vblank with vsync active
-      set_dma_buffer_src(buf++, hblank_buffer_vsync_on,  HBLANK_BUFFER_LEN);
-      set_dma_buffer_src(buf++, hpixels_buffer_vsync_on, HPIXELS_BUFFER_LEN);
-    } else if (i < V_SYNC_PULSE+V_BACK_PORCH || i >= V_SYNC_PULSE+V_BACK_PORCH+V_PIXELS) {
-      // vblank with vsync inactive
-      set_dma_buffer_src(buf++, hblank_buffer_vsync_off,  HBLANK_BUFFER_LEN);
-      set_dma_buffer_src(buf++, hpixels_buffer_vsync_off, HPIXELS_BUFFER_LEN);
-    } else {
-      // pixel data
-      set_dma_buffer_src(buf++, hblank_buffer_vsync_off, HBLANK_BUFFER_LEN);
-      set_dma_buffer_src(buf++, NULL, HPIXELS_BUFFER_LEN);  // set by vga_swap_buffers()
+  // framebuffer lines for drawing
+  for (int i = 0; i < num_framebuffers; i++) {
+    for (int y = 0; y < canvas_height; y++) {
+      framebuffer_lines[i][y] = &framebuffers[i][y*(canvas_width/4)];
     }
+    chain_scroll_x[i] = 0;
+    chain_scroll_y[i] = 0;
   }
 
+  // setup DMA chain buffers for the visible lines
+  if (num_line_buffers > 0) {
+    // hblank and pixel data from line buffer ring
+    struct DMA_BUFFER_INFO *buf = dma_chains[0];
+    for (int i = 0; i < V_PIXELS; i++) {
+      int y = i / V_DIV;
+      set_dma_buffer_src(buf++, &line_buffers[(y % num_line_buffers) * LINE_BUFFER_LEN], LINE_BUFFER_LEN);
+    }
+  }
+  for (int fb = 0; fb < num_framebuffers; fb++) {
+    // pixel data from framebuffer
+    struct DMA_BUFFER_INFO *buf = dma_chains[fb];
+    for (int i = 0; i < V_PIXELS; i++) {
+#if ! VGA_ENABLE_PIO_SYNC
+      set_dma_buffer_src(buf++, blank_lines_vsync_off, HBLANK_BUFFER_LEN);
+#endif
+      set_dma_buffer_src(buf++, framebuffer_lines[fb][i/V_DIV], HPIXELS_BUFFER_LEN);
+    }
+  }
+
+#if ! VGA_ENABLE_PIO_SYNC
+  // setup DMA chain buffers for the blank lines
+  struct DMA_BUFFER_INFO *buf = dma_blank_chain;
+  buf = set_dma_blank_lines_src(buf, blank_lines_vsync_off, V_FRONT_PORCH);
+  buf = set_dma_blank_lines_src(buf, blank_lines_vsync_on,  V_SYNC_PULSE);
+  buf = set_dma_blank_lines_src(buf, blank_lines_vsync_off, V_BACK_PORCH);
+
+  dma_blank_chain_start[0] = dma_blank_chain;
+#endif
+
   // setup DMA restart buffer
-  dma_restart_buffer[0] = &dma_chain[0];
+  dma_restart_buffer[0] = dma_chains[0];
+
+  return 0;
+}
+
+// add a framebuffer to the display queue (call with frame_lock held)
+static void queue_frame(int fb, enum VGA_FRAME_POLICY policy)
+{
+  if (policy == VGA_FRAME_LATEST) {
+    frame_queue_len = 0;  // drop frames not shown yet
+  }
+  frame_queue[frame_queue_len++] = fb;
+}
+
+static bool is_framebuffer_free(int fb)
+{
+  if (fb == shown_framebuffer || fb == cur_framebuffer) return false;
+  for (int i = 0; i < frame_queue_len; i++) {
+    if (frame_queue[i] == fb) return false;
+  }
+  return true;
+}
+
+#if VGA_ENABLE_MULTICORE
+
+// Jobs for core1 in a single producer (core0), single consumer (core1)
+// ring: core0 only writes job_head, core1 only writes job_tail and
+// jobs_done.  The counters wrap around, JOB_QUEUE_LEN must be a power of 2.
+#define JOB_QUEUE_LEN 32
+
+struct VGA_JOB {
+  vga_job_func func;
+  void *data;
+};
+
+static struct VGA_JOB job_queue[JOB_QUEUE_LEN];
+static volatile uint job_head;        // jobs submitted
+static volatile uint job_tail;        // jobs taken by core1
+static volatile uint jobs_done;       // jobs finished by core1
+static volatile bool core1_running;
+
+void (*volatile vga_core1_func)(void);
+
+static void core1_main(void)
+{
+  core1_running = true;
+  __sev();
+
+  while (true) {
+    uint tail = job_tail;
+    if (tail != job_head) {
+      __dmb();  // read the job after seeing it was published
+      struct VGA_JOB job = job_queue[tail % JOB_QUEUE_LEN];
+      job_tail = tail + 1;
+      job.func(job.data);
+      __dmb();  // make the job's writes visible before reporting it done
+      jobs_done = tail + 1;
+      __sev();
+    } else if (vga_core1_func) {
+      vga_core1_func();
+    } else {
+      __wfe();
+    }
+  }
+}
+
+static int init_core1(void)
+{
+  if (core1_running) return 0;
 
+  multicore_launch_core1(core1_main);
+  uint32_t start = time_us_32();
+  while (! core1_running) {
+    if (time_us_32() - start > 100000) return VGA_ERROR_MULTICORE;
+    tight_loop_contents();
+  }
   return 0;
 }
 
+#endif /* VGA_ENABLE_MULTICORE */
+
 // === INTERFACE ====================================================
 
+#if VGA_ENABLE_MULTICORE
+void vga_core1_submit(vga_job_func func, void *data)
+{
+  uint head = job_head;
+  while (head - job_tail >= JOB_QUEUE_LEN) {
+    tight_loop_contents();
+  }
+  job_queue[head % JOB_QUEUE_LEN].func = func;
+  job_queue[head % JOB_QUEUE_LEN].data = data;
+  __dmb();  // write the job before publishing it
+  job_head = head + 1;
+  __sev();
+}
+
+void vga_core1_fence(void)
+{
+  while (jobs_done != job_head) {
+    tight_loop_contents();
+  }
+  __dmb();
+}
+#endif
+
+void vga_submit_frame(void)
+{
+  if (cur_framebuffer < 0) return;
+#if VGA_ENABLE_MULTICORE
+  vga_core1_fence();
+#endif
+  vga_clear_wait();
+
+  uint32_t save = spin_lock_blocking(frame_lock);
+  queue_frame(cur_framebuffer, frame_policy);
+  spin_unlock(frame_lock, save);
+
+  cur_framebuffer = -1;
+  vga_screen.framebuffer = NULL;
+}
+
+bool vga_acquire_back_buffer(void)
+{
+  if (cur_framebuffer >= 0) return true;
+
+  uint32_t save = spin_lock_blocking(frame_lock);
+  for (int fb = 0; fb < num_framebuffers; fb++) {
+    if (is_framebuffer_free(fb)) {
+      cur_framebuffer = fb;
+      break;
+    }
+  }
+  spin_unlock(frame_lock, save);
+
+  if (cur_framebuffer < 0) return false;
+  vga_screen.framebuffer = framebuffer_lines[cur_framebuffer];
+  if (auto_clear_color >= 0) start_dma_clear(cur_framebuffer, auto_clear_color);
+  return true;
+}
+
 void vga_swap_buffers(bool wait_sync)
 {
+#if VGA_ENABLE_MULTICORE
+  vga_core1_fence();
+#endif
+  vga_clear_wait();
+
+  // the DMA IRQ handler switches to the new chain at the end of the current frame
+  if (num_framebuffers > 0 && cur_framebuffer >= 0) {
+    uint32_t save = spin_lock_blocking(frame_lock);
+    queue_frame(cur_framebuffer, VGA_FRAME_LATEST);
+    spin_unlock(frame_lock, save);
+  }
+
   if (wait_sync) {
     uint start_frame_count = frame_count;
     while (frame_count == start_frame_count) {
-      //sleep_ms(1);  // should we remove this?
+      tight_loop_contents();
     }
   }
-  
-  // inject new framebuffer in DMA chain
-  for (int i = 0; i < V_PIXELS; i++) {
-    struct DMA_BUFFER_INFO *buf = &dma_chain[2*(V_SYNC_PULSE+V_BACK_PORCH+i) + 1];
-    set_dma_buffer_src(buf, &framebuffers[cur_framebuffer][i/V_DIV*HPIXELS_BUFFER_LEN], HPIXELS_BUFFER_LEN);
-  }
+  if (num_framebuffers == 0) return;
 
-  // setup old framebuffer for drawing
-  cur_framebuffer = !cur_framebuffer;
-  for (int i = 0; i < SCREEN_HEIGHT; i++) {
-    cur_framebuffer_lines[i] = &framebuffers[cur_framebuffer][i*HPIXELS_BUFFER_LEN];
+  // setup the next framebuffer that's not shown or queued for drawing;
+  // with a single buffer (or two without waiting for sync) there's none,
+  // so the next one is used even if it's being shown
+  uint32_t save = spin_lock_blocking(frame_lock);
+  int last = (cur_framebuffer < 0) ? shown_framebuffer : cur_framebuffer;
+  cur_framebuffer = -1;
+  for (int i = 1; i <= num_framebuffers; i++) {
+    int fb = (last + i) % num_framebuffers;
+    if (is_framebuffer_free(fb)) {
+      cur_framebuffer = fb;
+      break;
+    }
   }
+  if (cur_framebuffer < 0) cur_framebuffer = (last + 1) % num_framebuffers;
+  spin_unlock(frame_lock, save);
+  vga_screen.framebuffer = framebuffer_lines[cur_framebuffer];
+  if (auto_clear_color >= 0) start_dma_clear(cur_framebuffer, auto_clear_color);
 }
 
 void vga_clear_screen(unsigned char color)
 {
+  if (cur_framebuffer < 0) return;
+  vga_clear_wait();
   clear_framebuffer(cur_framebuffer, color);
 }
 
-int vga_init(const struct VGA_MODE *mode, unsigned int pin_out_base)
+void vga_clear_screen_async(unsigned char color)
+{
+  if (cur_framebuffer < 0) return;
+  start_dma_clear(cur_framebuffer, color);
+}
+
+void vga_clear_wait_lines(int num_lines)
+{
+  if (dma_clear_fb < 0) return;
+
+  // the write address tells how far the clear has gone
+  uintptr_t start = (uintptr_t) framebuffers[dma_clear_fb];
+  while (dma_channel_is_busy(dma_clear_chan) &&
+         (int) ((dma_hw->ch[dma_clear_chan].write_addr - start) / canvas_width) < num_lines) {
+    tight_loop_contents();
+  }
+}
+
+void vga_clear_wait(void)
+{
+  vga_clear_wait_lines(canvas_height);
+}
+
+void vga_set_auto_clear(int color)
+{
+  auto_clear_color = (color < 0) ? -1 : (color & 0x3f);
+}
+
+void vga_set_line_source(int line, const unsigned int *src)
+{
+  if (cur_framebuffer < 0 || line < 0 || line >= SCREEN_HEIGHT) return;
+
+  // with a single buffer the chain is being shown, and the DMA IRQ
+  // handler may be changing it
+  uint32_t save = spin_lock_blocking(frame_lock);
+  set_chain_line_source(dma_chains[cur_framebuffer], line, src);
+  spin_unlock(frame_lock, save);
+}
+
+void vga_reset_line_sources(void)
+{
+  if (cur_framebuffer < 0) return;
+
+  // reset to the window at the scroll origin; with a single buffer the
+  // DMA IRQ handler may be changing the same chain
+  uint32_t save = spin_lock_blocking(frame_lock);
+  set_chain_scroll(cur_framebuffer, scroll_x, scroll_y);
+  spin_unlock(frame_lock, save);
+}
+
+void vga_set_scroll(int x, int y)
+{
+  if (canvas_height == 0) return;  // not initialized
+
+  // x in steps of 4 pixels (1 word), y wraps around the canvas
+  if (x > canvas_width - SCREEN_WIDTH) x = canvas_width - SCREEN_WIDTH;
+  if (x < 0) x = 0;
+  x &= ~3;
+  y %= canvas_height;
+  if (y < 0) y += canvas_height;
+
+  uint32_t save = spin_lock_blocking(frame_lock);
+  scroll_x = x;
+  scroll_y = y;
+  spin_unlock(frame_lock, save);
+}
+
+unsigned int vga_scanline_budget_cycles(void)
+{
+  uint64_t f_clk_sys = (uint64_t) frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_SYS) * 1000;
+  return f_clk_sys * H_FULL_LINE * V_DIV / PIX_CLOCK_MHZ;
+}
+
+unsigned int vga_scanline_late_lines(void)
+{
+  return scanline_late;
+}
+
+void vga_get_stats(struct VGA_STATS *stats)
+{
+  stats->frames          = frame_count - stats_start_frame;
+  stats->repeated_frames = stats_repeated_frames;
+  stats->underrun_frames = stats_underrun_frames;
+  stats->late_lines      = scanline_late - stats_start_late_lines;
+
+  // a bus error stops the channel, so there won't be another interrupt to check it
+  uint32_t error_bits = DMA_CH0_CTRL_TRIG_AHB_ERROR_BITS;
+  stats->dma_error = ((dma_hw->ch[dma_control_chan].ctrl_trig & error_bits) != 0 ||
+                      (dma_hw->ch[dma_data_chan].ctrl_trig & error_bits) != 0);
+}
+
+void vga_reset_stats(void)
+{
+  stats_start_frame = frame_count;
+  stats_start_late_lines = scanline_late;
+  stats_repeated_frames = 0;
+  stats_underrun_frames = 0;
+}
+
+static int init_vga(const struct VGA_MODE *mode, unsigned int pin_out_base)
 {
   vga_mode = mode;
+  frame_lock = spin_lock_instance(spin_lock_claim_unused(true));
+  frame_queue_len = 0;
+  shown_framebuffer = 0;
+  cur_framebuffer = -1;
+  scroll_x = 0;
+  scroll_y = 0;
+  frame_underrun = false;
+  vga_reset_stats();
 
-  int err = init_buffers(2);
+  int err = init_buffers();
   if (err < 0) return err;
 
   err = init_pio(pin_out_base);
   if (err < 0) return err;
 
-  vga_screen.width       = SCREEN_WIDTH;
-  vga_screen.height      = SCREEN_HEIGHT;
+#if VGA_ENABLE_MULTICORE
+  err = init_core1();
+  if (err < 0) return err;
+#endif
+
+  vga_screen.width       = canvas_width;
+  vga_screen.height      = canvas_height;
   vga_screen.sync_bits   = SYNC_BITS;
-  vga_screen.framebuffer = cur_framebuffer_lines;
+  vga_screen.framebuffer = NULL;
 
-  // setup first framebuffer
-  cur_framebuffer = 0;
-  vga_swap_buffers(false);
+  if (scanline_func) {
+    // render the first lines before the beam gets there
+    scanline_next = 0;
+    scanline_vblank = true;
+    render_scanlines();
+  } else {
+    // show the first framebuffer, draw on the second (or on the first if there's only one)
+    cur_framebuffer = 1 % num_framebuffers;
+    vga_screen.framebuffer = framebuffer_lines[cur_framebuffer];
+  }
 
   // start video output
   //bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_DMA_W_BITS | BUSCTRL_BUS_PRIORITY_DMA_R_BITS;
   dma_channel_start(dma_control_chan);
+#if VGA_ENABLE_PIO_SYNC
+  pio_enable_sm_mask_in_sync(pio0, pio_sync_sm_mask);
+#endif
   return 0;
 }
+
+int vga_init(const struct VGA_MODE *mode, unsigned int pin_out_base)
+{
+  canvas_width     = mode->h_pixels;
+  canvas_height    = mode->v_pixels / mode->v_div;
+  num_framebuffers = 2;
+  num_line_buffers = 0;
+  scanline_func    = NULL;
+  frame_policy     = VGA_FRAME_LATEST;
+  return init_vga(mode, pin_out_base);
+}
+
+int vga_init_triple_buffer(const struct VGA_MODE *mode, unsigned int pin_out_base, enum VGA_FRAME_POLICY policy)
+{
+  canvas_width     = mode->h_pixels;
+  canvas_height    = mode->v_pixels / mode->v_div;
+  num_framebuffers = 3;
+  num_line_buffers = 0;
+  scanline_func    = NULL;
+  frame_policy     = policy;
+  return init_vga(mode, pin_out_base);
+}
+
+int vga_init_scanline(const struct VGA_MODE *mode, unsigned int pin_out_base,
+                      int num_lines, vga_scanline_func render_line)
+{
+  if (num_lines < 2 || num_lines > mode->v_pixels/mode->v_div || ! render_line) {
+    return VGA_ERROR_PARAM;
+  }
+  canvas_width     = mode->h_pixels;
+  canvas_height    = mode->v_pixels / mode->v_div;
+  num_framebuffers = 0;
+  num_line_buffers = num_lines;
+  scanline_func    = render_line;
+  return init_vga(mode, pin_out_base);
+}
+
+int vga_init_virtual(const struct VGA_MODE *mode, unsigned int pin_out_base,
+                     int width, int height, int num_buffers)
+{
+  if (width < mode->h_pixels || width % 4 != 0 || height < mode->v_pixels/mode->v_div ||
+      num_buffers < 1 || num_buffers > MAX_FRAMEBUFFERS) {
+    return VGA_ERROR_PARAM;
+  }
+  canvas_width     = width;
+  canvas_height    = height;
+  num_framebuffers = num_buffers;
+  num_line_buffers = 0;
+  scanline_func    = NULL;
+  frame_policy     = VGA_FRAME_LATEST;
+  return init_vga(mode, pin_out_base);
+}
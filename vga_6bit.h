@@ -5,6 +5,7 @@
 
 #define VGA_ERROR_ALLOC     (-1)
 #define VGA_ERROR_MULTICORE (-2)
+#define VGA_ERROR_PARAM     (-3)
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,15 +35,100 @@ struct VGA_SCREEN {
   unsigned char sync_bits;
   unsigned int **framebuffer;
 };
+
+// Scanout statistics since vga_init() or vga_reset_stats().  A frame
+// is repeated when no new frame was submitted before it ended (with
+// more than one framebuffer), and has an underrun when the PIO ran out
+// of pixels because the DMA couldn't keep up (which the monitor sees
+// as a glitch or loss of sync).
+struct VGA_STATS {
+  unsigned int frames;            // frames sent to the monitor
+  unsigned int repeated_frames;
+  unsigned int underrun_frames;
+  unsigned int late_lines;        // lines rendered too late in scanline mode
+  bool dma_error;                 // a DMA bus error stopped the output
+};
+
+// What to do with a submitted frame while another is still waiting to
+// be shown.
+enum VGA_FRAME_POLICY {
+  VGA_FRAME_LATEST,   // replace the waiting frame
+  VGA_FRAME_FIFO,     // show both, in order
+};
+
+// Renders screen line `y` into `line` (in scanline mode).  Called from
+// the DMA interrupt handler, shortly before the line is sent to the
+// monitor.
+typedef void (*vga_scanline_func)(unsigned int *line, int y);
   
 #if VGA_ENABLE_MULTICORE
+// Jobs run by core1, in the order they were submitted.  Submitting
+// waits if the queue is full; vga_core1_fence() waits until all
+// submitted jobs are done, and is called by vga_swap_buffers() and
+// vga_submit_frame() so jobs drawing a frame finish before it's shown.
+// When it has no jobs, core1 calls vga_core1_func (if set) in a loop.
+typedef void (*vga_job_func)(void *data);
+
 extern void (*volatile vga_core1_func)(void);
+void vga_core1_submit(vga_job_func func, void *data);
+void vga_core1_fence(void);
 #endif
 
 int vga_init(const struct VGA_MODE *mode, unsigned int pin_out_base);
 void vga_clear_screen(unsigned char color);
 void vga_swap_buffers(bool wait_sync);
 
+// Background clear of the framebuffer being drawn, done by DMA while
+// the CPU does other work.  vga_clear_wait() waits until it's done and
+// vga_clear_wait_lines(n) until its first n lines are cleared; the
+// functions in vga_draw.c and vga_font.c wait for the lines they draw
+// on.  vga_set_auto_clear(color) starts a clear on each new buffer
+// from vga_swap_buffers() or vga_acquire_back_buffer() (-1 disables).
+void vga_clear_screen_async(unsigned char color);
+void vga_clear_wait(void);
+void vga_clear_wait_lines(int num_lines);
+void vga_set_auto_clear(int color);
+
+// Triple buffering: instead of vga_swap_buffers(), vga_submit_frame()
+// queues the frame being drawn to be shown from the next frame on (a
+// frame still waiting is replaced or kept according to the policy),
+// and vga_acquire_back_buffer() sets vga_screen.framebuffer to a
+// buffer that's neither shown nor queued.  It returns false if there's
+// none yet, which only happens with VGA_FRAME_FIFO when two frames are
+// waiting.  vga_swap_buffers() always uses VGA_FRAME_LATEST.
+int vga_init_triple_buffer(const struct VGA_MODE *mode, unsigned int pin_out_base, enum VGA_FRAME_POLICY policy);
+void vga_submit_frame(void);
+bool vga_acquire_back_buffer(void);
+
+// Line sources of the framebuffer being drawn: when it's shown, screen
+// line `line` is read from `src` (the mode's h_pixels bytes,
+// word-aligned, with the sync bits), which can be any line of any
+// framebuffer or other memory.  On a virtual canvas that's less than
+// vga_screen.width (the canvas width), so `src` can point inside a
+// canvas line.  Sources stay with their framebuffer until changed or
+// reset to its own lines (the window at the scroll origin).
+void vga_set_line_source(int line, const unsigned int *src);
+void vga_reset_line_sources(void);
+
+// Virtual canvas: framebuffers of width x height pixels (width a
+// multiple of 4), of which the screen shows the window at the scroll
+// origin.  vga_screen.width and vga_screen.height are the canvas size.
+// With a single buffer, drawing goes straight to the canvas being
+// shown.  The scroll origin takes effect at the start of the next
+// frame: x is rounded down to a multiple of 4 and clamped to the
+// canvas, y wraps around.  Changing it resets the line sources.
+int vga_init_virtual(const struct VGA_MODE *mode, unsigned int pin_out_base,
+                     int width, int height, int num_buffers);
+void vga_set_scroll(int x, int y);
+
+int vga_init_scanline(const struct VGA_MODE *mode, unsigned int pin_out_base,
+                      int num_lines, vga_scanline_func render_line);
+unsigned int vga_scanline_budget_cycles(void);
+unsigned int vga_scanline_late_lines(void);
+
+void vga_get_stats(struct VGA_STATS *stats);
+void vga_reset_stats(void);
+
 extern struct VGA_SCREEN vga_screen;
 
 extern const struct VGA_MODE vga_mode_320x240;
@@ -1,5 +1,79 @@
 
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
 #include "vga_draw.h"
+#include "vga_font.h"
+
+#if VGA_ENABLE_MULTICORE
+#include "pico/platform.h"
+#define CUR_CORE  get_core_num()
+#else
+#define CUR_CORE  0
+#endif
+
+#define DRAW_LIST_MAX_CMDS  256   // max commands recorded before a flush
+#define DRAW_LIST_TEXT_LEN  1024  // space for the text of recorded commands
+
+#if DRAW_TILE_SIZE % 4 != 0
+#error "DRAW_TILE_SIZE must be a multiple of 4"
+#endif
+#define TILE_WORDS (DRAW_TILE_SIZE/4)
+
+// words per line of the pre-shifted copies of a sprite (shifted by up to 3 pixels)
+#define PRESHIFT_STRIDE(width) (((width) + 3 + 3) / 4)
+
+#define DIRTY_MAX_BUFFERS   4     // framebuffers tracked for dirty rectangles
+#define DIRTY_MAX_RECTS     32    // dirty rectangles per framebuffer
+
+enum DRAW_CMD_TYPE {
+  DRAW_CMD_CLEAR,
+  DRAW_CMD_SPRITE,
+  DRAW_CMD_TEXT,
+  DRAW_CMD_TILEMAP,
+};
+
+struct DRAW_CMD {
+  enum DRAW_CMD_TYPE type;
+  int x;
+  int y;
+  unsigned char color;
+  unsigned char border_color;
+  unsigned int flags;   // sprite flags or text border
+  const void *src;  // sprite, font or tilemap
+  int text;       // offset of text in draw_list_text
+};
+
+// vertical clip of each core
+static int clip_top[2];
+static int clip_bottom[2] = { 1<<30, 1<<30 };
+
+static bool draw_list_recording;
+static bool draw_list_split;
+static int draw_list_num_cmds;
+static int draw_list_text_len;
+static struct DRAW_CMD draw_list_cmds[DRAW_LIST_MAX_CMDS];
+static char draw_list_text[DRAW_LIST_TEXT_LEN];
+
+// Areas drawn on each framebuffer since it last held just the
+// background.  x0 and x1 are multiples of 4.
+struct DIRTY_RECT {
+  int x0, y0;
+  int x1, y1;
+};
+
+struct DIRTY_LIST {
+  unsigned int **framebuffer;
+  bool full;      // whole screen dirty
+  int num_rects;
+  struct DIRTY_RECT rects[DIRTY_MAX_RECTS];
+};
+
+static const struct SPRITE *background_image;
+static draw_background_func background_func;
+static struct DIRTY_LIST dirty_lists[DIRTY_MAX_BUFFERS];
+static int dirty_next_evict;
 
 #define GET_PIX0_TRANSP_MASK(block) ((((block) & 0x0000003f) != 0x0000000c) ? 0x000000ff : 0)
 #define GET_PIX1_TRANSP_MASK(block) ((((block) & 0x00003f00) != 0x00000c00) ? 0x0000ff00 : 0)
@@ -310,18 +384,221 @@ static void draw_image_line_tr3(unsigned int *screen, const unsigned int *image,
   }
 }
 
-void draw_sprite(struct SPRITE *spr, int spr_x, int spr_y, bool transparent)
+// Draw a line of whole words, masking the first and last ones
+static void draw_image_line_masked(unsigned int *screen, const unsigned int *image, int num_words,
+                                   unsigned int first_mask, unsigned int last_mask)
+{
+  if (num_words == 1) {
+    unsigned int mask = first_mask & last_mask;
+    *screen = (*screen & ~mask) | (*image & mask);
+    return;
+  }
+
+  *screen = (*screen & ~first_mask) | (*image++ & first_mask);
+  screen++;
+  for (int x = 0; x < num_words-2; x++) {
+    *screen++ = *image++;
+  }
+  *screen = (*screen & ~last_mask) | (*image & last_mask);
+}
+
+// Draw a sprite at an unaligned x using its copy pre-shifted to that
+// position, so every line is drawn a whole word at a time.
+static void render_preshifted(const struct SPRITE *spr, int spr_x, int spr_y, int first_line, int height, bool transparent)
+{
+  int shift = spr_x & 3;
+  const unsigned int *image_start = spr->shifted[shift-1] + spr->shifted_stride*first_line;
+  int word_x = (spr_x - shift) / 4;
+  int num_words = (shift + spr->width + 3) / 4;
+
+  // pixels outside the image in the first and last words
+  int last_pixels = (shift + spr->width) % 4;
+  unsigned int first_mask = 0xffffffff << (8*shift);
+  unsigned int last_mask = (last_pixels == 0) ? 0xffffffff : 0xffffffff >> (8*(4-last_pixels));
+
+  if (word_x < 0) {
+    image_start += -word_x;
+    num_words += word_x;
+    word_x = 0;
+    first_mask = 0xffffffff;
+  }
+  if (num_words > vga_screen.width/4 - word_x) {
+    num_words = vga_screen.width/4 - word_x;
+    last_mask = 0xffffffff;
+  }
+  if (num_words <= 0) return;
+
+  unsigned int **line = vga_screen.framebuffer;
+  if (transparent) {
+    // the padding is transparent, so no masks are needed
+    for (int y = 0; y < height; y++) draw_image_line_tr0(line[y+spr_y] + word_x, image_start + spr->shifted_stride*y, num_words*4);
+  } else {
+    for (int y = 0; y < height; y++) draw_image_line_masked(line[y+spr_y] + word_x, image_start + spr->shifted_stride*y, num_words, first_mask, last_mask);
+  }
+}
+
+// Copy a run of pixels with word stores where the destination is
+// aligned.  Words of src are only read if they hold pixels of the run.
+static void copy_run(unsigned char *dst, const unsigned char *src, int len)
+{
+  while (len > 0 && ((uintptr_t) dst & 3) != 0) {
+    *dst++ = *src++;
+    len--;
+  }
+
+  unsigned int *dst_word = (unsigned int *) dst;
+  int offset = (uintptr_t) src & 3;
+  if (offset == 0) {
+    const unsigned int *src_word = (const unsigned int *) src;
+    for (; len >= 4; len -= 4) {
+      *dst_word++ = *src_word++;
+    }
+  } else if (len >= 4) {
+    const unsigned int *src_word = (const unsigned int *) (src - offset);
+    unsigned int cur = *src_word++;
+    for (; len >= 4; len -= 4) {
+      unsigned int next = *src_word++;
+      *dst_word++ = (cur >> (8*offset)) | (next << (32 - 8*offset));
+      cur = next;
+    }
+  }
+  src += (unsigned char *) dst_word - dst;
+  dst = (unsigned char *) dst_word;
+
+  while (len-- > 0) {
+    *dst++ = *src++;
+  }
+}
+
+// Draw a transparent sprite from its spans (see draw_encode_spans()):
+// only the opaque pixels are touched.
+static void render_spans(const struct SPRITE *spr, int spr_x, int spr_y, int first_line, int height)
+{
+  for (int y = 0; y < height; y++) {
+    unsigned char *screen = (unsigned char *) vga_screen.framebuffer[y+spr_y];
+    const unsigned int *span = spr->spans + spr->spans[first_line+y];
+    int x = spr_x;
+    while (true) {
+      int skip = *span & 0xffff;
+      int len  = *span >> 16;
+      if (len == 0) break;
+      const unsigned char *src = (const unsigned char *) (span + 1);
+      span += 1 + (len + 3) / 4;
+
+      x += skip;
+      int start = x;
+      x += len;
+      if (start < 0) {
+        src -= start;
+        len += start;
+        start = 0;
+      }
+      if (len > vga_screen.width - start) len = vga_screen.width - start;
+      if (len > 0) copy_run(screen + start, src, len);
+    }
+  }
+}
+
+// Flipped lines: screen pixel x (for x0 <= x < x1) gets image pixel
+// end-x.  Each whole screen word gets 4 consecutive image pixels
+// (merged from 2 image words if unaligned) with the bytes reversed.
+static void draw_image_line_flip(unsigned char *screen, const unsigned int *image, int end, int x0, int x1)
+{
+  const unsigned char *pixels = (const unsigned char *) image;
+  int x = x0;
+  for (; x < x1 && (x & 3) != 0; x++) {
+    screen[x] = pixels[end - x];
+  }
+
+  if (x + 4 <= x1) {
+    int first = end - x - 3;
+    const unsigned int *src = image + first/4;
+    int shift = 8 * (first % 4);
+    for (; x + 4 <= x1; x += 4) {
+      unsigned int block = (shift == 0) ? src[0] : ((src[0] >> shift) | (src[1] << (32 - shift)));
+      *(unsigned int *) &screen[x] = __builtin_bswap32(block);
+      src--;
+    }
+  }
+
+  for (; x < x1; x++) {
+    screen[x] = pixels[end - x];
+  }
+}
+
+static void draw_image_line_flip_tr(unsigned char *screen, const unsigned int *image, int end, int x0, int x1)
+{
+  const unsigned char *pixels = (const unsigned char *) image;
+  int x = x0;
+  for (; x < x1 && (x & 3) != 0; x++) {
+    if ((pixels[end - x] & 0x3f) != 0x0c) screen[x] = pixels[end - x];
+  }
+
+  if (x + 4 <= x1) {
+    int first = end - x - 3;
+    const unsigned int *src = image + first/4;
+    int shift = 8 * (first % 4);
+    for (; x + 4 <= x1; x += 4) {
+      unsigned int block = (shift == 0) ? src[0] : ((src[0] >> shift) | (src[1] << (32 - shift)));
+      block = __builtin_bswap32(block);
+      unsigned int mask = GET_4PIX_TRANSP_MASK(block);
+      unsigned int *dst = (unsigned int *) &screen[x];
+      if (mask == 0xffffffff) {
+        *dst = block;
+      } else {
+        *dst = (*dst & ~mask) | (block & mask);
+      }
+      src--;
+    }
+  }
+
+  for (; x < x1; x++) {
+    if ((pixels[end - x] & 0x3f) != 0x0c) screen[x] = pixels[end - x];
+  }
+}
+
+static void render_sprite(const struct SPRITE *spr, int spr_x, int spr_y, unsigned int flags)
 {
   const unsigned int *image_start = spr->data;
+  bool transparent = (flags & DRAW_TRANSPARENT) != 0;
+
+  int top, bottom;
+  draw_get_clip_lines(&top, &bottom);
 
   int height = spr->height;
-  if (spr_y < 0) {
-    image_start += spr->stride * (-spr_y);
-    height += spr_y;
-    spr_y = 0;
+  int first_line = 0;
+  if (spr_y < top) {
+    first_line = top - spr_y;
+    image_start += spr->stride * first_line;
+    height -= first_line;
+    spr_y = top;
   }
-  if (height > vga_screen.height - spr_y) height = vga_screen.height - spr_y;
+  if (height > bottom - spr_y) height = bottom - spr_y;
   if (height <= 0) return;
+  vga_clear_wait_lines(spr_y + height);
+
+  if (flags & DRAW_FLIP_H) {
+    int x0 = (spr_x > 0) ? spr_x : 0;
+    int x1 = (spr_x + spr->width < vga_screen.width) ? spr_x + spr->width : vga_screen.width;
+    if (x0 >= x1) return;
+    int end = spr_x + spr->width - 1;
+    unsigned int **line = vga_screen.framebuffer;
+    if (transparent) {
+      for (int y = 0; y < height; y++) draw_image_line_flip_tr((unsigned char *) line[y+spr_y], image_start + spr->stride*y, end, x0, x1);
+    } else {
+      for (int y = 0; y < height; y++) draw_image_line_flip((unsigned char *) line[y+spr_y], image_start + spr->stride*y, end, x0, x1);
+    }
+    return;
+  }
+
+  if (transparent && spr->spans) {
+    render_spans(spr, spr_x, spr_y, first_line, height);
+    return;
+  }
+  if ((spr_x & 3) != 0 && spr->shifted[0]) {
+    render_preshifted(spr, spr_x, spr_y, first_line, height, transparent);
+    return;
+  }
 
   bool skip_first_block = false;
   int width = spr->width;
@@ -351,3 +628,506 @@ void draw_sprite(struct SPRITE *spr, int spr_x, int spr_y, bool transparent)
     }
   }
 }
+
+// Draw num_words words of a tilemap line starting at map pixel
+// (map_x, map_y).  Whole tiles are copied with a loop of fixed size,
+// tiles cut by the start or end of the line by a loop of variable size.
+static void render_tilemap_line(const struct TILEMAP *tm, unsigned int *dst, int map_x, int map_y, int num_words)
+{
+  const unsigned char *map_line = tm->map + tm->width * (map_y / DRAW_TILE_SIZE);
+  const unsigned int *tile_line = tm->tiles + TILE_WORDS * (map_y % DRAW_TILE_SIZE);
+  int col = map_x / DRAW_TILE_SIZE;
+  int word = (map_x % DRAW_TILE_SIZE) / 4;
+
+  while (num_words > 0) {
+    const unsigned int *src = tile_line + map_line[col] * (TILE_WORDS * DRAW_TILE_SIZE);
+    if (word == 0 && num_words >= TILE_WORDS) {
+      for (int i = 0; i < TILE_WORDS; i++) {
+        dst[i] = src[i];
+      }
+      dst += TILE_WORDS;
+      num_words -= TILE_WORDS;
+    } else {
+      int n = TILE_WORDS - word;
+      if (n > num_words) n = num_words;
+      for (int i = 0; i < n; i++) {
+        dst[i] = src[word + i];
+      }
+      dst += n;
+      num_words -= n;
+      word = 0;
+    }
+    if (++col == tm->width) col = 0;
+  }
+}
+
+static void render_tilemap(const struct TILEMAP *tm, int scroll_x, int scroll_y, int x, int y, int width, int height)
+{
+  int top, bottom;
+  draw_get_clip_lines(&top, &bottom);
+
+  int x1 = x + width;
+  int y1 = y + height;
+  if (x < 0) x = 0;
+  if (y < top) y = top;
+  if (x1 > vga_screen.width) x1 = vga_screen.width;
+  if (y1 > bottom) y1 = bottom;
+  x &= ~3;
+  x1 = (x1 + 3) & ~3;
+  if (x >= x1 || y >= y1) return;
+  vga_clear_wait_lines(y1);
+
+  int map_width = tm->width * DRAW_TILE_SIZE;
+  int map_height = tm->height * DRAW_TILE_SIZE;
+  int map_x = ((scroll_x & ~3) + x) % map_width;
+  if (map_x < 0) map_x += map_width;
+  int map_y = (scroll_y + y) % map_height;
+  if (map_y < 0) map_y += map_height;
+
+  for (; y < y1; y++) {
+    render_tilemap_line(tm, vga_screen.framebuffer[y] + x/4, map_x, map_y, (x1 - x) / 4);
+    if (++map_y == map_height) map_y = 0;
+  }
+}
+
+static void render_clear(unsigned char color)
+{
+  int top, bottom;
+  draw_get_clip_lines(&top, &bottom);
+
+  unsigned char val = vga_screen.sync_bits | (color & 0x3f);
+  vga_clear_wait_lines(bottom);
+  for (int y = top; y < bottom; y++) {
+    memset(vga_screen.framebuffer[y], val, vga_screen.width);
+  }
+}
+
+void draw_set_clip_lines(int y0, int y1)
+{
+  clip_top[CUR_CORE] = y0;
+  clip_bottom[CUR_CORE] = y1;
+}
+
+void draw_reset_clip(void)
+{
+  draw_set_clip_lines(0, 1<<30);
+}
+
+void draw_get_clip_lines(int *y0, int *y1)
+{
+  int core = CUR_CORE;
+  *y0 = (clip_top[core] > 0) ? clip_top[core] : 0;
+  *y1 = (clip_bottom[core] < vga_screen.height) ? clip_bottom[core] : vga_screen.height;
+}
+
+// === DRAW LISTS ===================================================
+
+static void render_cmds(void)
+{
+  for (int i = 0; i < draw_list_num_cmds; i++) {
+    struct DRAW_CMD *cmd = &draw_list_cmds[i];
+    switch (cmd->type) {
+    case DRAW_CMD_CLEAR:
+      render_clear(cmd->color);
+      break;
+
+    case DRAW_CMD_SPRITE:
+      render_sprite(cmd->src, cmd->x, cmd->y, cmd->flags);
+      break;
+
+    case DRAW_CMD_TILEMAP:
+      render_tilemap(cmd->src, cmd->x, cmd->y, 0, 0, vga_screen.width, vga_screen.height);
+      break;
+
+    case DRAW_CMD_TEXT:
+      font_draw_text(cmd->src, cmd->x, cmd->y, &draw_list_text[cmd->text],
+                     cmd->color, cmd->flags, cmd->border_color);
+      break;
+    }
+  }
+}
+
+#if VGA_ENABLE_MULTICORE
+static void render_band(void *data)
+{
+  int *band = data;
+  int top = clip_top[CUR_CORE];
+  int bottom = clip_bottom[CUR_CORE];
+  draw_set_clip_lines(band[0], band[1]);
+  render_cmds();
+  draw_set_clip_lines(top, bottom);
+}
+#endif
+
+static void flush_cmds(void)
+{
+#if VGA_ENABLE_MULTICORE
+  if (draw_list_split) {
+    int top, bottom;
+    draw_get_clip_lines(&top, &bottom);
+    int mid = top + (bottom - top) / 2;
+
+    static int band[2][2];
+    band[0][0] = top;
+    band[0][1] = mid;
+    band[1][0] = mid;
+    band[1][1] = bottom;
+    vga_core1_submit(render_band, band[1]);
+    render_band(band[0]);
+    vga_core1_fence();
+  } else {
+    render_cmds();
+  }
+#else
+  render_cmds();
+#endif
+  draw_list_num_cmds = 0;
+  draw_list_text_len = 0;
+}
+
+static struct DRAW_CMD *add_cmd(enum DRAW_CMD_TYPE type, int text_len)
+{
+  if (text_len > DRAW_LIST_TEXT_LEN) return NULL;
+  if (draw_list_num_cmds >= DRAW_LIST_MAX_CMDS ||
+      draw_list_text_len + text_len > DRAW_LIST_TEXT_LEN) {
+    flush_cmds();
+  }
+  struct DRAW_CMD *cmd = &draw_list_cmds[draw_list_num_cmds++];
+  cmd->type = type;
+  cmd->text = draw_list_text_len;
+  draw_list_text_len += text_len;
+  return cmd;
+}
+
+void draw_list_begin(bool split)
+{
+  draw_list_recording = true;
+  draw_list_split = split;
+  draw_list_num_cmds = 0;
+  draw_list_text_len = 0;
+}
+
+void draw_list_end(void)
+{
+  if (! draw_list_recording) return;
+  flush_cmds();
+  draw_list_recording = false;
+}
+
+bool draw_list_has_sprite(const struct SPRITE *spr)
+{
+  if (! draw_list_recording) return false;
+  for (int i = 0; i < draw_list_num_cmds; i++) {
+    if (draw_list_cmds[i].type == DRAW_CMD_SPRITE && draw_list_cmds[i].src == spr) return true;
+  }
+  return false;
+}
+
+bool draw_list_add_text(const struct VGA_FONT *font, int x, int y, const char *text,
+                        unsigned char color, bool border, unsigned char border_color)
+{
+  if (! draw_list_recording) return false;
+
+  int len = strlen(text) + 1;
+  struct DRAW_CMD *cmd = add_cmd(DRAW_CMD_TEXT, len);
+  if (! cmd) {
+    // too long to record: draw it now, in order with the rest
+    flush_cmds();
+    font_draw_text(font, x, y, text, color, border, border_color);
+    return true;
+  }
+  cmd->src = font;
+  cmd->x = x;
+  cmd->y = y;
+  cmd->color = color;
+  cmd->flags = border;
+  cmd->border_color = border_color;
+  memcpy(&draw_list_text[cmd->text], text, len);
+  return true;
+}
+
+// === DIRTY RECTANGLES =============================================
+
+static struct DIRTY_LIST *get_dirty_list(unsigned int **framebuffer)
+{
+  for (int i = 0; i < DIRTY_MAX_BUFFERS; i++) {
+    if (dirty_lists[i].framebuffer == framebuffer) return &dirty_lists[i];
+  }
+
+  // not seen yet: we don't know what's there
+  struct DIRTY_LIST *list = &dirty_lists[dirty_next_evict];
+  dirty_next_evict = (dirty_next_evict + 1) % DIRTY_MAX_BUFFERS;
+  list->framebuffer = framebuffer;
+  list->full = true;
+  list->num_rects = 0;
+  return list;
+}
+
+static int rect_area(int x0, int y0, int x1, int y1)
+{
+  return (x1 - x0) * (y1 - y0);
+}
+
+static void merge_rect(struct DIRTY_RECT *dst, const struct DIRTY_RECT *src)
+{
+  if (src->x0 < dst->x0) dst->x0 = src->x0;
+  if (src->y0 < dst->y0) dst->y0 = src->y0;
+  if (src->x1 > dst->x1) dst->x1 = src->x1;
+  if (src->y1 > dst->y1) dst->y1 = src->y1;
+}
+
+// Return how much bigger the area covering both rectangles is than
+// the two rectangles.
+static int merge_cost(const struct DIRTY_RECT *a, const struct DIRTY_RECT *b)
+{
+  struct DIRTY_RECT u = *a;
+  merge_rect(&u, b);
+  return (rect_area(u.x0, u.y0, u.x1, u.y1) -
+          rect_area(a->x0, a->y0, a->x1, a->y1) -
+          rect_area(b->x0, b->y0, b->x1, b->y1));
+}
+
+static void add_dirty_rect(struct DIRTY_LIST *list, struct DIRTY_RECT rect)
+{
+  if (list->full) return;
+
+  // merge with rectangles that overlap it enough that the merged
+  // rectangle is not bigger than both, until there are none
+  for (int i = 0; i < list->num_rects; ) {
+    if (merge_cost(&list->rects[i], &rect) <= 0) {
+      merge_rect(&rect, &list->rects[i]);
+      list->rects[i] = list->rects[--list->num_rects];
+      i = 0;
+    } else {
+      i++;
+    }
+  }
+
+  if (list->num_rects < DIRTY_MAX_RECTS) {
+    list->rects[list->num_rects++] = rect;
+    return;
+  }
+
+  // no room: merge with the cheapest one
+  int best = 0;
+  for (int i = 1; i < list->num_rects; i++) {
+    if (merge_cost(&list->rects[i], &rect) < merge_cost(&list->rects[best], &rect)) {
+      best = i;
+    }
+  }
+  merge_rect(&list->rects[best], &rect);
+}
+
+static void restore_from_image(int x, int y, int width, int height)
+{
+  const struct SPRITE *img = background_image;
+  if (x + width  > img->width)  width  = img->width - x;
+  if (y + height > img->height) height = img->height - y;
+  if (width <= 0 || height <= 0) return;
+
+  for (int i = y; i < y + height; i++) {
+    memcpy(vga_screen.framebuffer[i] + x/4, img->data + img->stride*i + x/4, width);
+  }
+}
+
+static void restore_rect(int x, int y, int width, int height)
+{
+  vga_clear_wait_lines(y + height);
+  if (background_image) {
+    restore_from_image(x, y, width, height);
+  } else {
+    background_func(x, y, width, height);
+  }
+}
+
+// Return the number of words needed for the spans of a sprite, and
+// store them in spans if it's not NULL.
+static unsigned int encode_spans(const struct SPRITE *spr, unsigned int *spans)
+{
+  unsigned int pos = spr->height;   // line offsets come first
+  for (int y = 0; y < spr->height; y++) {
+    const unsigned char *line = (const unsigned char *) (spr->data + spr->stride*y);
+    if (spans) spans[y] = pos;
+
+    int x = 0;
+    int last = 0;   // end of the previous span
+    while (x < spr->width) {
+      if ((line[x] & 0x3f) == 0x0c) {
+        x++;
+        continue;
+      }
+      int start = x;
+      while (x < spr->width && (line[x] & 0x3f) != 0x0c && x - start < 0xffff) {
+        x++;
+      }
+      if (spans) {
+        spans[pos] = (start - last) | ((x - start) << 16);
+        memcpy(&spans[pos+1], line + start, x - start);
+      }
+      pos += 1 + (x - start + 3) / 4;
+      last = x;
+    }
+    if (spans) spans[pos] = 0;   // end of line
+    pos++;
+  }
+  return pos;
+}
+
+// === INTERFACE ====================================================
+
+unsigned int draw_spans_size(const struct SPRITE *spr)
+{
+  return encode_spans(spr, NULL) * sizeof(unsigned int);
+}
+
+bool draw_encode_spans(struct SPRITE *spr, unsigned int max_bytes)
+{
+  if (spr->spans) return true;
+  if (draw_spans_size(spr) > max_bytes) return false;
+
+  unsigned int *spans = malloc(draw_spans_size(spr));
+  if (! spans) return false;
+  encode_spans(spr, spans);
+  spr->spans = spans;
+  return true;
+}
+
+void draw_free_spans(struct SPRITE *spr)
+{
+  free((void *) spr->spans);
+  spr->spans = NULL;
+}
+
+unsigned int draw_preshift_size(const struct SPRITE *spr)
+{
+  return 3 * PRESHIFT_STRIDE(spr->width) * spr->height * sizeof(unsigned int);
+}
+
+bool draw_preshift_sprite(struct SPRITE *spr, unsigned int max_bytes)
+{
+  if (spr->shifted[0]) return true;
+  if (draw_preshift_size(spr) > max_bytes) return false;
+
+  unsigned int *copies = malloc(draw_preshift_size(spr));
+  if (! copies) return false;
+
+  unsigned int stride = PRESHIFT_STRIDE(spr->width);
+  unsigned char pad = vga_screen.sync_bits | 0x0c;  // transparent
+  for (int shift = 1; shift <= 3; shift++) {
+    unsigned int *copy = copies + (shift-1)*stride*spr->height;
+    for (int y = 0; y < spr->height; y++) {
+      unsigned char *dst = (unsigned char *) (copy + stride*y);
+      memset(dst, pad, stride*4);
+      memcpy(dst + shift, spr->data + spr->stride*y, spr->width);
+    }
+    spr->shifted[shift-1] = copy;
+  }
+  spr->shifted_stride = stride;
+  return true;
+}
+
+void draw_free_preshift(struct SPRITE *spr)
+{
+  free((void *) spr->shifted[0]);
+  for (int i = 0; i < 3; i++) {
+    spr->shifted[i] = NULL;
+  }
+  spr->shifted_stride = 0;
+}
+
+void draw_set_background(const struct SPRITE *image)
+{
+  background_image = image;
+  background_func = NULL;
+  for (int i = 0; i < DIRTY_MAX_BUFFERS; i++) {
+    dirty_lists[i].full = true;
+  }
+}
+
+void draw_set_background_func(draw_background_func func)
+{
+  draw_set_background(NULL);
+  background_func = func;
+}
+
+void draw_mark_dirty(int x, int y, int width, int height)
+{
+  if (! background_image && ! background_func) return;
+
+  // clip to the screen, widen to whole words
+  struct DIRTY_RECT rect = { x, y, x + width, y + height };
+  if (rect.x0 < 0) rect.x0 = 0;
+  if (rect.y0 < 0) rect.y0 = 0;
+  if (rect.x1 > vga_screen.width)  rect.x1 = vga_screen.width;
+  if (rect.y1 > vga_screen.height) rect.y1 = vga_screen.height;
+  if (rect.x0 >= rect.x1 || rect.y0 >= rect.y1) return;
+  rect.x0 &= ~3;
+  rect.x1 = (rect.x1 + 3) & ~3;
+
+  add_dirty_rect(get_dirty_list(vga_screen.framebuffer), rect);
+}
+
+void draw_restore_background(void)
+{
+  if (! background_image && ! background_func) return;
+
+  struct DIRTY_LIST *list = get_dirty_list(vga_screen.framebuffer);
+  if (list->full) {
+    restore_rect(0, 0, vga_screen.width, vga_screen.height);
+  } else {
+    for (int i = 0; i < list->num_rects; i++) {
+      struct DIRTY_RECT *r = &list->rects[i];
+      restore_rect(r->x0, r->y0, r->x1 - r->x0, r->y1 - r->y0);
+    }
+  }
+  list->full = false;
+  list->num_rects = 0;
+}
+
+void draw_clear(unsigned char color)
+{
+  if (background_image || background_func) {
+    get_dirty_list(vga_screen.framebuffer)->full = true;
+  }
+  if (draw_list_recording) {
+    struct DRAW_CMD *cmd = add_cmd(DRAW_CMD_CLEAR, 0);
+    cmd->color = color;
+    return;
+  }
+  render_clear(color);
+}
+
+void draw_tilemap(const struct TILEMAP *tilemap, int scroll_x, int scroll_y)
+{
+  if (background_image || background_func) {
+    get_dirty_list(vga_screen.framebuffer)->full = true;
+  }
+  if (draw_list_recording) {
+    struct DRAW_CMD *cmd = add_cmd(DRAW_CMD_TILEMAP, 0);
+    cmd->src = tilemap;
+    cmd->x = scroll_x;
+    cmd->y = scroll_y;
+    return;
+  }
+  render_tilemap(tilemap, scroll_x, scroll_y, 0, 0, vga_screen.width, vga_screen.height);
+}
+
+void draw_tilemap_rect(const struct TILEMAP *tilemap, int scroll_x, int scroll_y,
+                       int x, int y, int width, int height)
+{
+  render_tilemap(tilemap, scroll_x, scroll_y, x, y, width, height);
+}
+
+void draw_sprite(struct SPRITE *spr, int spr_x, int spr_y, unsigned int flags)
+{
+  draw_mark_dirty(spr_x, spr_y, spr->width, spr->height);
+  if (draw_list_recording) {
+    struct DRAW_CMD *cmd = add_cmd(DRAW_CMD_SPRITE, 0);
+    cmd->src = spr;
+    cmd->x = spr_x;
+    cmd->y = spr_y;
+    cmd->flags = flags;
+    return;
+  }
+  render_sprite(spr, spr_x, spr_y, flags);
+}
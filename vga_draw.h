@@ -5,6 +5,11 @@
 
 #include "vga_6bit.h"
 
+// Width and height of tilemap tiles in pixels (a multiple of 4)
+#ifndef DRAW_TILE_SIZE
+#define DRAW_TILE_SIZE 64
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -14,9 +19,99 @@ struct SPRITE {
   int height;
   unsigned int stride;  // number of words per line
   const unsigned int *data;
+
+  // optional copies of the image shifted right by 1, 2 and 3 pixels,
+  // padded with the transparent color (see draw_preshift_sprite())
+  const unsigned int *shifted[3];
+  unsigned int shifted_stride;
+
+  // optional runs of opaque pixels of each line (see draw_encode_spans())
+  const unsigned int *spans;
+};
+
+// A map of width x height tiles, wrapping around when scrolled.  Each
+// tile image is DRAW_TILE_SIZE lines of DRAW_TILE_SIZE/4 words (with
+// the sync bits), one after the other in tiles.
+struct TILEMAP {
+  int width;
+  int height;
+  const unsigned char *map;
+  const unsigned int *tiles;
 };
 
-void draw_sprite(struct SPRITE *sprite, int spr_x, int spr_y, bool transparent);
+struct VGA_FONT;
+
+// draw_sprite() flags
+#define DRAW_TRANSPARENT  1   // don't draw pixels of color 0x0c
+#define DRAW_FLIP_H       2   // mirror the image horizontally
+
+void draw_sprite(struct SPRITE *sprite, int spr_x, int spr_y, unsigned int flags);
+void draw_clear(unsigned char color);
+
+// Draw the tilemap over the screen, with map pixel (scroll_x, scroll_y)
+// at the top left (scroll_x is rounded down to a multiple of 4).
+// draw_tilemap_rect() draws just the rectangle at (x, y) of the screen
+// (x and width are rounded to multiples of 4), is not recorded in draw
+// lists and doesn't mark it as dirty, so it can be used to draw the
+// background of dirty rectangles.
+void draw_tilemap(const struct TILEMAP *tilemap, int scroll_x, int scroll_y);
+void draw_tilemap_rect(const struct TILEMAP *tilemap, int scroll_x, int scroll_y,
+                       int x, int y, int width, int height);
+
+// Pre-shifted sprites are drawn at any x without realigning each word
+// of the image, at the cost of draw_preshift_size() bytes of memory.
+// draw_preshift_sprite() makes the copies (after vga_init(), with the
+// sync bits of the image) if they take at most max_bytes.
+unsigned int draw_preshift_size(const struct SPRITE *sprite);
+bool draw_preshift_sprite(struct SPRITE *sprite, unsigned int max_bytes);
+void draw_free_preshift(struct SPRITE *sprite);
+
+// Sprites with spans are drawn with transparency by copying just their
+// runs of opaque pixels, which is faster for mostly transparent
+// images.  The spans are made by draw_encode_spans() if they take at
+// most max_bytes.  Each line starts at the offset stored in
+// spans[line] and has a word for each run (pixels to skip in bits
+// 0-15, run length in bits 16-31) followed by its pixels padded to
+// whole words, and ends with a 0 word.
+unsigned int draw_spans_size(const struct SPRITE *sprite);
+bool draw_encode_spans(struct SPRITE *sprite, unsigned int max_bytes);
+void draw_free_spans(struct SPRITE *sprite);
+
+// Drawing by the calling core is clipped to screen lines [y0, y1).
+void draw_set_clip_lines(int y0, int y1);
+void draw_reset_clip(void);
+void draw_get_clip_lines(int *y0, int *y1);
+
+// Draw lists: between draw_list_begin() and draw_list_end(), calls to
+// draw_clear(), draw_sprite() and font_print() are recorded instead of
+// drawn, and draw_list_end() draws them.  With split (and
+// VGA_ENABLE_MULTICORE), core0 draws the top half of the screen while
+// core1 draws the bottom half.  Sprites must stay valid until the list
+// is drawn.
+void draw_list_begin(bool split);
+void draw_list_end(void);
+
+// Returns true if the sprite is used by the draw list being recorded.
+bool draw_list_has_sprite(const struct SPRITE *sprite);
+
+// Dirty rectangles: draw_sprite() and font_print() record the areas
+// they draw on in each framebuffer, and draw_restore_background()
+// redraws from the background just the areas drawn on the framebuffer
+// being drawn since it was last restored (the whole screen the first
+// time).  The background is either a screen-sized image with the sync
+// bits or a function that draws a rectangle of it (x and width are
+// multiples of 4).  Restoring is done immediately, even inside a draw
+// list.
+typedef void (*draw_background_func)(int x, int y, int width, int height);
+
+void draw_set_background(const struct SPRITE *image);
+void draw_set_background_func(draw_background_func func);
+void draw_mark_dirty(int x, int y, int width, int height);
+void draw_restore_background(void);
+
+// Records text for font_print(), returns false if not recording.
+bool draw_list_add_text(const struct VGA_FONT *font, int x, int y, const char *text,
+                        unsigned char color, bool border, unsigned char border_color);
 
 #ifdef __cplusplus
 }
@@ -1,7 +1,24 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 #include "vga_font.h"
+#include "vga_draw.h"
+#include "vga_pixel_masks.h"
+
+// Tallest font drawn with a border in a single pass
+#ifndef VGA_FONT_MAX_HEIGHT
+#define VGA_FONT_MAX_HEIGHT 16
+#endif
+
+// Number of strings kept by font_print_cached(), and their maximum length
+#ifndef FONT_CACHE_ENTRIES
+#define FONT_CACHE_ENTRIES 8
+#endif
+#ifndef FONT_CACHE_TEXT_LEN
+#define FONT_CACHE_TEXT_LEN 32
+#endif
 
 static char print_buf[32];
 static const struct VGA_FONT *font;
@@ -69,53 +86,377 @@ void font_print_float(float num)
   font_print(print_buf);
 }
 
-static int render_text(const char *text, int x, int y, unsigned int color)
+// see vga_pixel_masks.h
+const uint32_t vga_pixel_masks[16] = {
+  0x00000000, 0x000000ff, 0x0000ff00, 0x0000ffff,
+  0x00ff0000, 0x00ff00ff, 0x00ffff00, 0x00ffffff,
+  0xff000000, 0xff0000ff, 0xff00ff00, 0xff00ffff,
+  0xffff0000, 0xffff00ff, 0xffffff00, 0xffffffff,
+};
+
+// A character of the font: its rows (one of the two is set, bit i is
+// pixel i) and how far it moves the text position
+struct GLYPH {
+  const unsigned char *rows;
+  const unsigned short *wide_rows;
+  int advance;
+};
+
+// Gets the glyph of a character, returns false (with the advance of
+// the font) if the font doesn't have it.
+static bool get_glyph(const struct VGA_FONT *font, int ch, struct GLYPH *glyph)
+{
+  if (ch < font->first_char || ch >= font->first_char+font->num_chars) {
+    glyph->advance = font->w;
+    return false;
+  }
+  int index = ch - font->first_char;
+  glyph->rows = (font->data) ? &font->data[font->h * index] : NULL;
+  glyph->wide_rows = (font->data) ? NULL : &font->wide_data[font->h * index];
+  glyph->advance = (font->advance) ? font->advance[index] : font->w;
+  return true;
+}
+
+static inline unsigned int get_glyph_row(const struct GLYPH *glyph, int row)
 {
-  while (*text != '\0') {
-    char ch = *text++;
-    if (ch >= font->first_char && ch < font->first_char+font->num_chars) {
-      ch -= font->first_char;
-      for (int i = 0; i < font->h; i++) {
-        uint8_t char_line = font->data[font->h*ch + i];
-        uint8_t char_bit = 1;
-        for (int j = 0; j < font->w; j++) {
-          if ((char_line & char_bit) != 0 &&
-              y+i >= 0 &&
-              x+j >= 0 &&
-              y+i < vga_screen.height &&
-              x+j < vga_screen.width) {
-            ((unsigned char *) vga_screen.framebuffer[y+i])[x+j] = color;
-          }
-          char_bit <<= 1;
-        }
+  return (glyph->rows) ? glyph->rows[row] : glyph->wide_rows[row];
+}
+
+// Where text is rendered: the screen (data is NULL) or a sprite image
+struct TEXT_TARGET {
+  unsigned int *data;
+  int words;          // words per line
+  int top, bottom;    // lines that can be drawn
+};
+
+static void get_screen_target(struct TEXT_TARGET *target)
+{
+  target->data = NULL;
+  target->words = vga_screen.width / 4;
+  draw_get_clip_lines(&target->top, &target->bottom);
+}
+
+static uint32_t *get_target_line(const struct TEXT_TARGET *target, int y)
+{
+  if (target->data) return (uint32_t *) target->data + target->words*y;
+  return (uint32_t *) vga_screen.framebuffer[y];
+}
+
+// Draws each glyph a whole framebuffer word at a time: every row is
+// shifted to the glyph's position in its first word and each nibble
+// selects the byte mask of a word, which is merged with the color.
+// Clipping is decided once per glyph: lines outside the clip lines are
+// skipped, and since the target width is a multiple of 4, so are words
+// outside the target.
+static int render_text(const struct TEXT_TARGET *target, const struct VGA_FONT *font,
+                       const char *text, int x, int y, unsigned int color)
+{
+  int first_row = (y < target->top) ? target->top - y : 0;
+  int end_row = (y + font->h > target->bottom) ? target->bottom - y : font->h;
+  int words = target->words;
+  uint32_t color_word = (color & 0xff) * 0x01010101u;
+
+  struct GLYPH glyph;
+  for (; *text != '\0'; x += glyph.advance) {
+    if (! get_glyph(font, (unsigned char) *text++, &glyph)) continue;
+    if (first_row >= end_row || x + glyph.advance <= 0 || x >= 4*words) continue;
+
+    int shift = x & 3;
+    int word_x = (x - shift) / 4;
+    int first_word = (word_x < 0) ? -word_x : 0;
+    int end_word = (shift + glyph.advance + 3) / 4;
+    if (word_x + end_word > words) end_word = words - word_x;
+
+    for (int i = first_row; i < end_row; i++) {
+      uint32_t bits = get_glyph_row(&glyph, i) << shift;
+      if (bits == 0) continue;
+
+      uint32_t *line = get_target_line(target, y+i);
+      for (int j = first_word; j < end_word; j++) {
+        uint32_t mask = vga_pixel_masks[(bits >> 4*j) & 0xf];
+        if (mask != 0) line[word_x+j] = (line[word_x+j] & ~mask) | (color_word & mask);
       }
     }
-    x += font->w;
   }
 
   return x;
 }
 
-void font_print(const char *text)
+// Draws text with a 1 pixel border in a single pass.  Each glyph is
+// drawn in a box 1 pixel larger on each side, with the border mask
+// (the glyph dilated by 1 pixel) computed once per glyph.  Borders
+// never cover the fill of the glyph or its neighbors, which gives the
+// same result as drawing all borders before the text.
+static int render_text_border(const struct TEXT_TARGET *target, const struct VGA_FONT *font,
+                              const char *text, int x, int y,
+                              unsigned int color, unsigned int border_color)
 {
-  if (text == NULL) return;
-  
-  switch (font_alignment) {
-  case FONT_ALIGN_LEFT:   /* nothing to do */ break;
-  case FONT_ALIGN_CENTER: font_x -= strlen(text) * font->w / 2; break;
-  case FONT_ALIGN_RIGHT:  font_x -= strlen(text) * font->w; break;
+  int first_row = (y - 1 < target->top) ? target->top - y : -1;
+  int end_row = (y + font->h + 1 > target->bottom) ? target->bottom - y : font->h + 1;
+  int words = target->words;
+  uint32_t color_word = (color & 0xff) * 0x01010101u;
+  uint32_t border_word = (border_color & 0xff) * 0x01010101u;
+
+  struct GLYPH glyph, prev = { 0 }, next = { 0 };
+  bool has_prev = false;
+  for (; *text != '\0'; x += glyph.advance) {
+    bool has_glyph = get_glyph(font, (unsigned char) *text++, &glyph);
+    bool has_next = (*text != '\0' && get_glyph(font, (unsigned char) *text, &next));
+    bool has_left = has_prev;
+    struct GLYPH left = prev;
+    has_prev = has_glyph;
+    prev = glyph;
+    if (! has_glyph) continue;
+    if (first_row >= end_row || x + glyph.advance + 1 <= 0 || x - 1 >= 4*words) continue;
+
+    // Rows of the box start 1 pixel left of the glyph (bit i+1 is pixel
+    // i).  `covered` has the fill of the glyph and its neighbors.
+    unsigned int fill[VGA_FONT_MAX_HEIGHT+2];
+    unsigned int covered[VGA_FONT_MAX_HEIGHT+2];
+    unsigned int outline[VGA_FONT_MAX_HEIGHT+2];
+    int num_rows = font->h + 2;
+    fill[0] = fill[num_rows-1] = 0;
+    covered[0] = covered[num_rows-1] = 0;
+    outline[0] = outline[num_rows-1] = 0;
+    for (int r = 1; r < num_rows-1; r++) {
+      unsigned int row = get_glyph_row(&glyph, r-1);
+      fill[r] = row << 1;
+      covered[r] = fill[r];
+      if (has_left && left.advance > 0) covered[r] |= (get_glyph_row(&left, r-1) >> (left.advance - 1)) & 1;
+      if (has_next) covered[r] |= (get_glyph_row(&next, r-1) & 1) << (glyph.advance + 1);
+      outline[r] = row | (row << 1) | (row << 2);
+    }
+    unsigned int above = 0;
+    for (int r = 0; r < num_rows; r++) {
+      unsigned int cur = outline[r];
+      outline[r] = above | cur | ((r < num_rows-1) ? outline[r+1] : 0);
+      above = cur;
+    }
+
+    int box_x = x - 1;
+    int shift = box_x & 3;
+    int word_x = (box_x - shift) / 4;
+    int first_word = (word_x < 0) ? -word_x : 0;
+    int end_word = (shift + glyph.advance + 2 + 3) / 4;
+    if (word_x + end_word > words) end_word = words - word_x;
+
+    for (int i = first_row; i < end_row; i++) {
+      uint32_t fill_bits = fill[i+1] << shift;
+      uint32_t border_bits = (outline[i+1] & ~covered[i+1]) << shift;
+      if ((fill_bits | border_bits) == 0) continue;
+
+      uint32_t *line = get_target_line(target, y+i);
+      for (int j = first_word; j < end_word; j++) {
+        uint32_t fill_mask = vga_pixel_masks[(fill_bits >> 4*j) & 0xf];
+        uint32_t border_mask = vga_pixel_masks[(border_bits >> 4*j) & 0xf];
+        uint32_t mask = fill_mask | border_mask;
+        if (mask != 0) {
+          line[word_x+j] = ((line[word_x+j] & ~mask) |
+                            (color_word & fill_mask) |
+                            (border_word & border_mask));
+        }
+      }
+    }
   }
 
-  if (border[0]) {
+  return x;
+}
+
+static void render_text_target(const struct TEXT_TARGET *target, const struct VGA_FONT *font,
+                               int x, int y, const char *text,
+                               unsigned char color, bool border, unsigned char border_color)
+{
+  if (border && font->h <= VGA_FONT_MAX_HEIGHT) {
+    render_text_border(target, font, text, x, y, color, border_color);
+    return;
+  }
+  if (border) {
     for (int i = -1; i <= 1; i++) {
       for (int j = -1; j <= 1; j++) {
         if (i == 0 && j == 0) continue;
-        render_text(text, font_x+i, font_y+j, border[1]);
+        render_text(target, font, text, x+i, y+j, border_color);
       }
     }
   }
-  int new_x = render_text(text, font_x, font_y, font_color);
+  render_text(target, font, text, x, y, color);
+}
+
+// === TEXT CACHE ===================================================
+
+struct TEXT_CACHE_ENTRY {
+  const struct VGA_FONT *font;
+  unsigned char color;
+  unsigned char border[2];
+  char text[FONT_CACHE_TEXT_LEN];
+  unsigned int last_used;
+  unsigned int data_size;   // allocated bytes of sprite.data
+  struct SPRITE sprite;
+};
+
+static struct TEXT_CACHE_ENTRY text_cache[FONT_CACHE_ENTRIES];
+static unsigned int text_cache_clock;
+
+static bool is_cached_text(const struct TEXT_CACHE_ENTRY *e, const char *text)
+{
+  return (e->font == font && e->color == font_color &&
+          e->border[0] == border[0] && (! border[0] || e->border[1] == border[1]) &&
+          strcmp(e->text, text) == 0);
+}
+
+// Renders the text with the current font state into the entry's
+// sprite, with the transparent color everywhere else.
+static bool render_cached_text(struct TEXT_CACHE_ENTRY *e, const char *text)
+{
+  int b = border[0] ? 1 : 0;
+  int width = font_text_width(font, text) + 2*b;
+  int height = font->h + 2*b;
+  int words = (width + 3) / 4;
+  unsigned int size = words * height * sizeof(unsigned int);
+
+  draw_free_spans(&e->sprite);
+  if (size > e->data_size) {
+    free((void *) e->sprite.data);
+    e->sprite.data = NULL;
+    e->data_size = 0;
+    e->font = NULL;
+    unsigned int *data = malloc(size);
+    if (! data) return false;
+    e->sprite.data = data;
+    e->data_size = size;
+  }
+
+  struct TEXT_TARGET target = { (unsigned int *) e->sprite.data, words, 0, height };
+  memset(target.data, vga_screen.sync_bits | 0x0c, size);
+  render_text_target(&target, font, b, b, text, font_color, border[0], border[1]);
+
+  e->sprite.width = width;
+  e->sprite.height = height;
+  e->sprite.stride = words;
+  draw_encode_spans(&e->sprite, size);
+  e->font = font;
+  e->color = font_color;
+  e->border[0] = border[0];
+  e->border[1] = border[1];
+  strcpy(e->text, text);
+  return true;
+}
+
+// Returns the cache entry with the text in the current font state,
+// rendering it over the least recently used entry if needed.  Entries
+// in the draw list being recorded are never replaced.
+static struct TEXT_CACHE_ENTRY *get_cached_text(const char *text)
+{
+  if (*text == '\0' || strlen(text) >= FONT_CACHE_TEXT_LEN) return NULL;
+
+  // the unaligned blitters read a word past sprites narrower than 4
+  // pixels, which would be past the end of the sprite's data
+  int b = border[0] ? 1 : 0;
+  if (font_text_width(font, text) + 2*b < 4) return NULL;
+
+  // the transparent color can't be drawn from a sprite
+  if ((font_color & 0x3f) == 0x0c || (border[0] && (border[1] & 0x3f) == 0x0c)) return NULL;
+
+  for (int i = 0; i < FONT_CACHE_ENTRIES; i++) {
+    struct TEXT_CACHE_ENTRY *e = &text_cache[i];
+    if (e->font != NULL && is_cached_text(e, text)) {
+      e->last_used = ++text_cache_clock;
+      return e;
+    }
+  }
+
+  struct TEXT_CACHE_ENTRY *victim = NULL;
+  for (int i = 0; i < FONT_CACHE_ENTRIES; i++) {
+    struct TEXT_CACHE_ENTRY *e = &text_cache[i];
+    if (e->font == NULL) {
+      victim = e;
+      break;
+    }
+    if (draw_list_has_sprite(&e->sprite)) continue;
+    if (! victim || e->last_used < victim->last_used) victim = e;
+  }
+  if (! victim || ! render_cached_text(victim, text)) return NULL;
+  victim->last_used = ++text_cache_clock;
+  return victim;
+}
+
+void font_clear_cache(void)
+{
+  for (int i = 0; i < FONT_CACHE_ENTRIES; i++) {
+    struct TEXT_CACHE_ENTRY *e = &text_cache[i];
+    draw_free_spans(&e->sprite);
+    free((void *) e->sprite.data);
+    memset(e, 0, sizeof(*e));
+  }
+}
+
+// === INTERFACE ====================================================
+
+int font_text_width(const struct VGA_FONT *font, const char *text)
+{
+  if (! font->advance) return strlen(text) * font->w;
+
+  int width = 0;
+  struct GLYPH glyph;
+  while (*text != '\0') {
+    get_glyph(font, (unsigned char) *text++, &glyph);
+    width += glyph.advance;
+  }
+  return width;
+}
+
+static void align_text(int width)
+{
+  switch (font_alignment) {
+  case FONT_ALIGN_LEFT:   /* nothing to do */ break;
+  case FONT_ALIGN_CENTER: font_x -= width / 2; break;
+  case FONT_ALIGN_RIGHT:  font_x -= width; break;
+  }
+}
+
+void font_print(const char *text)
+{
+  if (text == NULL) return;
+  
+  int width = font_text_width(font, text);
+  align_text(width);
+  int new_x = font_x + width;
+  if (border[0]) {
+    draw_mark_dirty(font_x-1, font_y-1, new_x-font_x+2, font->h+2);
+  } else {
+    draw_mark_dirty(font_x, font_y, new_x-font_x, font->h);
+  }
+  if (! draw_list_add_text(font, font_x, font_y, text, font_color, border[0], border[1])) {
+    font_draw_text(font, font_x, font_y, text, font_color, border[0], border[1]);
+  }
   if (font_alignment != FONT_ALIGN_RIGHT) {
     font_x = new_x;
   }
 }
+
+void font_print_cached(const char *text)
+{
+  if (text == NULL) return;
+
+  struct TEXT_CACHE_ENTRY *e = get_cached_text(text);
+  if (! e) {
+    font_print(text);
+    return;
+  }
+
+  int b = border[0] ? 1 : 0;
+  int width = e->sprite.width - 2*b;
+  align_text(width);
+  draw_sprite(&e->sprite, font_x - b, font_y - b, DRAW_TRANSPARENT);
+  if (font_alignment != FONT_ALIGN_RIGHT) {
+    font_x += width;
+  }
+}
+
+void font_draw_text(const struct VGA_FONT *font, int x, int y, const char *text,
+                    unsigned char color, bool border, unsigned char border_color)
+{
+  struct TEXT_TARGET target;
+  get_screen_target(&target);
+  vga_clear_wait_lines(y + font->h + 1);
+  render_text_target(&target, font, x, y, text, color, border, border_color);
+}
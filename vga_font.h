@@ -9,12 +9,20 @@
 extern "C" {
 #endif
 
+// Glyph rows have bit i set for pixel i, and no pixels past the glyph's
+// advance.  Fonts have a byte per row in data or, for glyphs wider than
+// 8 pixels (up to 16), a 16-bit word per row in wide_data.  Glyphs move
+// the text position by w pixels, or by advance[ch - first_char] (at
+// least 1, at most w) in proportional fonts.  host/fontconv converts
+// BDF fonts and PNG strips to this format.
 struct VGA_FONT {
   int w;
   int h;
   int first_char;
   int num_chars;
   const unsigned char *data;
+  const unsigned char *advance;       // NULL for fixed width fonts
+  const unsigned short *wide_data;    // used if data is NULL
 };
 
 enum FONT_ALIGNMENT {
@@ -29,11 +37,25 @@ void font_set_border(int enable, unsigned int color);
 void font_move(unsigned int x, unsigned int y);
 void font_align(enum FONT_ALIGNMENT alignment);
 
+// Width in pixels of the text drawn with the font
+int font_text_width(const struct VGA_FONT *font, const char *text);
+
 void font_print_int(int num);
 void font_print_uint(unsigned int num);
 void font_print_float(float num);
 void font_print(const char *text);
 
+// Like font_print(), but draws the text from a sprite rendered the
+// first time the text is printed with the current font, color and
+// border.  The least recently used strings are dropped from the cache
+// to make room for new ones.  Use it for text that seldom changes.
+void font_print_cached(const char *text);
+void font_clear_cache(void);
+
+// Draws text at (x, y) without using or changing the font state.
+void font_draw_text(const struct VGA_FONT *font, int x, int y, const char *text,
+                    unsigned char color, bool border, unsigned char border_color);
+
 #if VGA_FONT_USE_STDARG
 void font_printf(const char *fmt, ...)
   __attribute__ ((format (printf, 1, 2)));
@@ -0,0 +1,12 @@
+#ifndef VGA_PIXEL_MASKS_H_FILE
+#define VGA_PIXEL_MASKS_H_FILE
+
+#include <stdint.h>
+
+// Private to the VGA code (defined in vga_font.c, also used by
+// vga_text.c).  Pixel masks for 4 pixels: byte i is 0xff if bit i of
+// the index is set, so glyph rows (bit i is pixel i) select pixels of
+// a framebuffer word a nibble at a time.
+extern const uint32_t vga_pixel_masks[16];
+
+#endif /* VGA_PIXEL_MASKS_H_FILE */
@@ -0,0 +1,136 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+
+#include "pico/stdlib.h"
+
+#include "vga_6bit.h"
+#include "vga_draw.h"
+#include "vga_prof.h"
+
+#define BAR_HEIGHT  4
+#define BAR_SPACING 1
+
+const unsigned char prof_colors[PROF_MAX_SCOPES] = {
+  0x03, 0x0c, 0x30, 0x0f, 0x3c, 0x33, 0x2a, 0x15,
+};
+
+static struct PROF_FRAME frames[PROF_HISTORY];
+static unsigned int num_frames;
+static bool started;
+static uint32_t frame_start_us;
+static const char *csv_names[PROF_MAX_SCOPES];
+static int csv_num_names = -1;
+
+static struct PROF_FRAME *cur_frame(void)
+{
+  return &frames[num_frames % PROF_HISTORY];
+}
+
+void prof_frame_start(void)
+{
+  uint32_t now = time_us_32();
+  if (started) {
+    cur_frame()->time_us = now - frame_start_us;
+    num_frames++;
+  }
+  started = true;
+  struct PROF_FRAME *frame = cur_frame();
+  frame->number = num_frames;
+  frame->time_us = 0;
+  frame->num_scopes = 0;
+  frame_start_us = now;
+}
+
+int prof_begin(const char *name)
+{
+  struct PROF_FRAME *frame = cur_frame();
+  if (frame->num_scopes >= PROF_MAX_SCOPES) return -1;
+  struct PROF_SCOPE *scope = &frame->scopes[frame->num_scopes];
+  scope->name = name;
+  scope->start_us = time_us_32() - frame_start_us;
+  scope->time_us = 0;
+  return frame->num_scopes++;
+}
+
+void prof_end(int scope)
+{
+  struct PROF_FRAME *frame = cur_frame();
+  if (scope < 0 || scope >= frame->num_scopes) return;
+  frame->scopes[scope].time_us = time_us_32() - frame_start_us - frame->scopes[scope].start_us;
+}
+
+const struct PROF_FRAME *prof_last_frame(void)
+{
+  if (num_frames == 0) return NULL;
+  return &frames[(num_frames - 1) % PROF_HISTORY];
+}
+
+static void fill_rect(int x, int y, int width, int height, unsigned char color)
+{
+  if (x < 0) { width += x; x = 0; }
+  if (y < 0) { height += y; y = 0; }
+  if (x + width > vga_screen.width) width = vga_screen.width - x;
+  if (y + height > vga_screen.height) height = vga_screen.height - y;
+  if (width <= 0 || height <= 0) return;
+
+  unsigned char val = vga_screen.sync_bits | (color & 0x3f);
+  vga_clear_wait_lines(y + height);
+  for (int i = y; i < y + height; i++) {
+    memset((unsigned char *) vga_screen.framebuffer[i] + x, val, width);
+  }
+}
+
+static int bar_length(uint32_t time_us, int width)
+{
+  uint32_t len = (uint32_t) ((uint64_t) time_us * width / PROF_BUDGET_US);
+  return (len > (uint32_t) width + 4) ? width + 4 : (int) len;
+}
+
+void prof_draw_overlay(int x, int y, int width)
+{
+  const struct PROF_FRAME *frame = prof_last_frame();
+  if (! frame) return;
+
+  int bar_y = y;
+  for (int i = 0; i < frame->num_scopes; i++) {
+    fill_rect(x, bar_y, bar_length(frame->scopes[i].time_us, width), BAR_HEIGHT, prof_colors[i]);
+    bar_y += BAR_HEIGHT + BAR_SPACING;
+  }
+  // the whole frame turns red when over budget
+  unsigned char total_color = (frame->time_us > PROF_BUDGET_US) ? 0x03 : 0x3f;
+  fill_rect(x, bar_y, bar_length(frame->time_us, width), BAR_HEIGHT, total_color);
+  bar_y += BAR_HEIGHT;
+  fill_rect(x + width, y, 1, bar_y - y, 0x3f);
+
+  // bars can go past the budget mark
+  draw_mark_dirty(x, y, width + 5, bar_y - y);
+}
+
+void prof_print_csv(void)
+{
+  const struct PROF_FRAME *frame = prof_last_frame();
+  if (! frame) return;
+
+  bool same_names = (csv_num_names == frame->num_scopes);
+  for (int i = 0; same_names && i < frame->num_scopes; i++) {
+    if (csv_names[i] != frame->scopes[i].name && strcmp(csv_names[i], frame->scopes[i].name) != 0) {
+      same_names = false;
+    }
+  }
+  if (! same_names) {
+    printf("frame,total");
+    for (int i = 0; i < frame->num_scopes; i++) {
+      printf(",%s", frame->scopes[i].name);
+      csv_names[i] = frame->scopes[i].name;
+    }
+    printf("\n");
+    csv_num_names = frame->num_scopes;
+  }
+
+  printf("%u,%u", frame->number, (unsigned int) frame->time_us);
+  for (int i = 0; i < frame->num_scopes; i++) {
+    printf(",%u", (unsigned int) frame->scopes[i].time_us);
+  }
+  printf("\n");
+}
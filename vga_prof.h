@@ -0,0 +1,68 @@
+#ifndef VGA_PROF_H_FILE
+#define VGA_PROF_H_FILE
+
+#include <stdint.h>
+
+// Most scopes timed in a frame
+#ifndef PROF_MAX_SCOPES
+#define PROF_MAX_SCOPES 8
+#endif
+
+// Number of frames kept
+#ifndef PROF_HISTORY
+#define PROF_HISTORY 8
+#endif
+
+// Time the overlay shows as the frame budget (60 fps)
+#ifndef PROF_BUDGET_US
+#define PROF_BUDGET_US 16667
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Frame profiler: prof_frame_start() starts a frame, and the time
+// between prof_begin(name) and prof_end() of the index it returns is
+// recorded as a scope of the frame (times are from time_us_32()).
+// The last PROF_HISTORY frames are kept in a ring.  Names must stay
+// valid while their frames are kept.
+struct PROF_SCOPE {
+  const char *name;
+  uint32_t start_us;   // from the start of the frame
+  uint32_t time_us;
+};
+
+struct PROF_FRAME {
+  unsigned int number;
+  uint32_t time_us;    // from its start to the start of the next frame
+  int num_scopes;
+  struct PROF_SCOPE scopes[PROF_MAX_SCOPES];
+};
+
+void prof_frame_start(void);
+int prof_begin(const char *name);
+void prof_end(int scope);
+
+// Returns the last complete frame, or NULL if there's none yet.
+const struct PROF_FRAME *prof_last_frame(void);
+
+// Draws a bar for each scope of the last complete frame (in order,
+// with the colors of prof_colors[]) and one for the whole frame, 4
+// pixels high and as long as their times over PROF_BUDGET_US,
+// followed by a mark at the budget.  The overlay is drawn straight to
+// the framebuffer being drawn, so it should be drawn last.
+void prof_draw_overlay(int x, int y, int width);
+
+// Prints the last complete frame as a CSV line (frame, total time and
+// each scope's time in us) to stdout, preceded by a header line with
+// the scope names whenever they change.
+void prof_print_csv(void);
+
+extern const unsigned char prof_colors[PROF_MAX_SCOPES];
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VGA_PROF_H_FILE */
@@ -0,0 +1,155 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "vga_text.h"
+#include "vga_pixel_masks.h"
+
+// number of scanline buffers used by text mode
+#ifndef VGA_TEXT_LINE_BUFFERS
+#define VGA_TEXT_LINE_BUFFERS 4
+#endif
+
+#define RGB(r, g, b)  ((r) | ((g) << 2) | ((b) << 4))
+
+struct VGA_TEXT vga_text;
+
+static int font_w;
+static int font_h;
+static unsigned char *glyph_rows;   // row r of character c at [256*r + c], in RAM
+
+// palette colors with the sync bits, as bytes and as words of 4 pixels
+static unsigned char palette[16] = {
+  RGB(0,0,0), RGB(0,0,2), RGB(0,2,0), RGB(0,2,2),
+  RGB(2,0,0), RGB(2,0,2), RGB(2,1,0), RGB(2,2,2),
+  RGB(1,1,1), RGB(1,1,3), RGB(1,3,1), RGB(1,3,3),
+  RGB(3,1,1), RGB(3,1,3), RGB(3,3,1), RGB(3,3,3),
+};
+static unsigned char palette_bytes[16];
+static uint32_t palette_words[16];
+static volatile bool palette_changed = true;
+
+static void update_palette(void)
+{
+  palette_changed = false;
+  for (int i = 0; i < 16; i++) {
+    palette_bytes[i] = vga_screen.sync_bits | (palette[i] & 0x3f);
+    palette_words[i] = palette_bytes[i] * 0x01010101u;
+  }
+}
+
+// Renders screen line y from the text buffers.  Fonts 6 pixels wide
+// (the usual case) are drawn two cells (3 words) at a time: each pixel
+// is the background color with the bits that differ in the foreground
+// color selected by the glyph mask.
+static void __time_critical_func(render_text_line)(unsigned int *line, int y)
+{
+  if (palette_changed) update_palette();
+
+  int row = y / font_h;
+  unsigned char *pix = (unsigned char *) line;
+  unsigned char *end = pix + vga_screen.width;
+  if (row < vga_text.rows) {
+    const unsigned char *chars = &vga_text.chars[row * vga_text.cols];
+    const unsigned char *attrs = &vga_text.attrs[row * vga_text.cols];
+    const unsigned char *glyphs = &glyph_rows[256 * (y - row*font_h)];
+    int col = 0;
+
+    if (font_w == 6) {
+      uint32_t *out = (uint32_t *) line;
+      for (; col + 2 <= vga_text.cols; col += 2) {
+        unsigned int bits = glyphs[chars[col]] | (glyphs[chars[col+1]] << 6);
+        uint32_t fg0 = palette_words[attrs[col] & 0xf];
+        uint32_t bg0 = palette_words[attrs[col] >> 4];
+        uint32_t fg1 = palette_words[attrs[col+1] & 0xf];
+        uint32_t bg1 = palette_words[attrs[col+1] >> 4];
+        uint32_t fg_mid = (fg0 & 0x0000ffff) | (fg1 & 0xffff0000);
+        uint32_t bg_mid = (bg0 & 0x0000ffff) | (bg1 & 0xffff0000);
+        out[0] = bg0    ^ ((fg0    ^ bg0)    & vga_pixel_masks[bits & 0xf]);
+        out[1] = bg_mid ^ ((fg_mid ^ bg_mid) & vga_pixel_masks[(bits >> 4) & 0xf]);
+        out[2] = bg1    ^ ((fg1    ^ bg1)    & vga_pixel_masks[bits >> 8]);
+        out += 3;
+      }
+      pix = (unsigned char *) out;
+    }
+
+    for (; col < vga_text.cols; col++) {
+      unsigned int bits = glyphs[chars[col]];
+      unsigned char fg = palette_bytes[attrs[col] & 0xf];
+      unsigned char bg = palette_bytes[attrs[col] >> 4];
+      for (int i = 0; i < font_w; i++) {
+        *pix++ = ((bits >> i) & 1) ? fg : bg;
+      }
+    }
+  }
+  while (pix < end) {
+    *pix++ = vga_screen.sync_bits;
+  }
+}
+
+// === INTERFACE ====================================================
+
+int vga_init_text(const struct VGA_MODE *mode, unsigned int pin_out_base, const struct VGA_FONT *font)
+{
+  int cols = mode->h_pixels / font->w;
+  int rows = mode->v_pixels / mode->v_div / font->h;
+  if (! font->data || font->advance || font->w < 1 || font->w > 8 || cols < 1 || rows < 1 ||
+      font->first_char < 0 || font->first_char + font->num_chars > 256) {
+    return VGA_ERROR_PARAM;
+  }
+
+  // copy the glyphs to RAM, so lines don't wait on flash
+  unsigned char *glyphs = calloc(256, font->h);
+  unsigned char *chars = malloc(cols * rows);
+  unsigned char *attrs = malloc(cols * rows);
+  if (! glyphs || ! chars || ! attrs) {
+    free(glyphs);
+    free(chars);
+    free(attrs);
+    return VGA_ERROR_ALLOC;
+  }
+  for (int c = 0; c < font->num_chars; c++) {
+    for (int r = 0; r < font->h; r++) {
+      glyphs[256*r + font->first_char + c] = font->data[font->h*c + r];
+    }
+  }
+
+  free(glyph_rows);
+  free(vga_text.chars);
+  free(vga_text.attrs);
+  glyph_rows = glyphs;
+  font_w = font->w;
+  font_h = font->h;
+  vga_text.cols = cols;
+  vga_text.rows = rows;
+  vga_text.chars = chars;
+  vga_text.attrs = attrs;
+  vga_text_clear(VGA_TEXT_ATTR(7, 0));
+  palette_changed = true;
+
+  return vga_init_scanline(mode, pin_out_base, VGA_TEXT_LINE_BUFFERS, render_text_line);
+}
+
+void vga_text_set_palette(int index, unsigned char color)
+{
+  palette[index & 0xf] = color & 0x3f;
+  palette_changed = true;
+}
+
+void vga_text_clear(unsigned char attr)
+{
+  memset(vga_text.chars, ' ', vga_text.cols * vga_text.rows);
+  memset(vga_text.attrs, attr, vga_text.cols * vga_text.rows);
+}
+
+void vga_text_print(int col, int row, const char *text, unsigned char attr)
+{
+  if (row < 0 || row >= vga_text.rows) return;
+  for (; *text != '\0' && col < vga_text.cols; col++, text++) {
+    if (col < 0) continue;
+    vga_text.chars[row * vga_text.cols + col] = *text;
+    vga_text.attrs[row * vga_text.cols + col] = attr;
+  }
+}
@@ -0,0 +1,38 @@
+#ifndef VGA_TEXT_H_FILE
+#define VGA_TEXT_H_FILE
+
+#include "vga_6bit.h"
+#include "vga_font.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Text mode: the screen shows a buffer of cols x rows characters, each
+// with an attribute byte selecting its colors from a 16 color palette
+// (foreground in bits 0-3, background in bits 4-7).  Lines are
+// rendered from the buffers as they are sent to the monitor (using
+// scanline mode), so there's no framebuffer and changes to a cell show
+// up in the next frame.  Pixels to the right of and below the last
+// cell are black.
+struct VGA_TEXT {
+  int cols;
+  int rows;
+  unsigned char *chars;   // cols*rows characters, row by row
+  unsigned char *attrs;   // cols*rows attributes, row by row
+};
+
+#define VGA_TEXT_ATTR(fg, bg)  ((((bg) & 0xf) << 4) | ((fg) & 0xf))
+
+int vga_init_text(const struct VGA_MODE *mode, unsigned int pin_out_base, const struct VGA_FONT *font);
+void vga_text_set_palette(int index, unsigned char color);
+void vga_text_clear(unsigned char attr);
+void vga_text_print(int col, int row, const char *text, unsigned char attr);
+
+extern struct VGA_TEXT vga_text;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VGA_TEXT_H_FILE */